@@ -53,6 +53,7 @@ namespace API {
 // Forward Declaration
 //----------------------------------------------------------------------
 class AlgorithmProxy;
+class AlgorithmManagerImpl;
 class AlgorithmHistory;
 class WorkspaceHistory;
 
@@ -325,12 +326,19 @@ protected:
   /// algorithm
   virtual const std::string workspaceMethodOnTypes() const { return ""; }
 
+  /// Returns true if the base processGroups() may execute the members of the
+  /// input groups concurrently. Only override this if executing the algorithm
+  /// on one member cannot affect its execution on another.
+  virtual bool processGroupsInParallel() const { return false; }
+
   void cacheWorkspaceProperties();
   void cacheInputWorkspaceHistories();
 
   friend class AlgorithmProxy;
   void initializeFromProxy(const AlgorithmProxy &);
 
+  friend class AlgorithmManagerImpl;
+
   void setInitialized();
   void setExecuted(bool state);
 
@@ -472,6 +480,7 @@ private:
   mutable double m_endChildProgress;   ///< Keeps value for algorithm's progress
                                        /// at Child Algorithm's finish
   AlgorithmID m_algorithmID;           ///< Algorithm ID for managed algorithms
+  bool m_isManaged; ///< Algorithm was created by the AlgorithmManager
   std::vector<boost::weak_ptr<IAlgorithm>> m_ChildAlgorithms; ///< A list of
                                                               /// weak pointers
                                                               /// to any child
@@ -0,0 +1,123 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_WORKSPACEEXPRESSION_H_
+#define MANTID_API_WORKSPACEEXPRESSION_H_
+
+#include "MantidAPI/DllConfig.h"
+#include "MantidAPI/MatrixWorkspace_fwd.h"
+
+#include <memory>
+
+namespace Mantid {
+namespace API {
+
+/** WorkspaceExpression : An arithmetic expression on matrix workspaces that is
+  only evaluated on request.
+
+  Combining expressions with + - * / builds an expression tree instead of
+  running Plus, Minus, Multiply or Divide for each operator. evaluate() then
+  computes the whole expression in a single pass over the spectra and creates
+  just one output workspace, e.g.
+
+    WorkspaceExpression lazySample(sample), lazyCan(can);
+    auto result = ((lazySample - 0.9 * lazyCan) / vanadium * scale).evaluate();
+
+  allocates one workspace instead of four temporaries. The errors are
+  propagated as in the binary operation algorithms, treating every operand as
+  uncorrelated. Single-valued workspaces and numbers (with zero error) are
+  applied to every bin. All other workspaces must have the same shape and
+  binning; the output takes its binning, instrument and units from the first
+  of them in the expression.
+
+  The constructors are explicit so that arithmetic on plain workspaces keeps
+  using the binary operation algorithms. Once one operand is an expression,
+  workspaces and numbers can be combined with it directly.
+*/
+class MANTID_API_DLL WorkspaceExpression {
+public:
+  explicit WorkspaceExpression(const MatrixWorkspace_sptr &workspace);
+  explicit WorkspaceExpression(const MatrixWorkspace_const_sptr &workspace);
+  explicit WorkspaceExpression(const double value);
+
+  MatrixWorkspace_sptr evaluate() const;
+
+  struct Node;
+
+private:
+  explicit WorkspaceExpression(std::shared_ptr<const Node> root);
+
+  /// The root of the expression tree. Nodes are immutable and may be shared
+  /// between expressions.
+  std::shared_ptr<const Node> m_root;
+
+  friend MANTID_API_DLL WorkspaceExpression
+  operator+(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+  friend MANTID_API_DLL WorkspaceExpression
+  operator-(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+  friend MANTID_API_DLL WorkspaceExpression
+  operator*(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+  friend MANTID_API_DLL WorkspaceExpression
+  operator/(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+};
+
+MANTID_API_DLL WorkspaceExpression operator+(const WorkspaceExpression &lhs,
+                                             const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression operator-(const WorkspaceExpression &lhs,
+                                             const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression operator*(const WorkspaceExpression &lhs,
+                                             const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression operator/(const WorkspaceExpression &lhs,
+                                             const WorkspaceExpression &rhs);
+
+MANTID_API_DLL WorkspaceExpression operator+(const WorkspaceExpression &lhs,
+                                             const double rhs);
+MANTID_API_DLL WorkspaceExpression operator+(const double lhs,
+                                             const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression
+operator+(const WorkspaceExpression &lhs,
+          const MatrixWorkspace_const_sptr &rhs);
+MANTID_API_DLL WorkspaceExpression
+operator+(const MatrixWorkspace_const_sptr &lhs,
+          const WorkspaceExpression &rhs);
+
+MANTID_API_DLL WorkspaceExpression operator-(const WorkspaceExpression &lhs,
+                                             const double rhs);
+MANTID_API_DLL WorkspaceExpression operator-(const double lhs,
+                                             const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression
+operator-(const WorkspaceExpression &lhs,
+          const MatrixWorkspace_const_sptr &rhs);
+MANTID_API_DLL WorkspaceExpression
+operator-(const MatrixWorkspace_const_sptr &lhs,
+          const WorkspaceExpression &rhs);
+
+MANTID_API_DLL WorkspaceExpression operator*(const WorkspaceExpression &lhs,
+                                             const double rhs);
+MANTID_API_DLL WorkspaceExpression operator*(const double lhs,
+                                             const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression
+operator*(const WorkspaceExpression &lhs,
+          const MatrixWorkspace_const_sptr &rhs);
+MANTID_API_DLL WorkspaceExpression
+operator*(const MatrixWorkspace_const_sptr &lhs,
+          const WorkspaceExpression &rhs);
+
+MANTID_API_DLL WorkspaceExpression operator/(const WorkspaceExpression &lhs,
+                                             const double rhs);
+MANTID_API_DLL WorkspaceExpression operator/(const double lhs,
+                                             const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression
+operator/(const WorkspaceExpression &lhs,
+          const MatrixWorkspace_const_sptr &rhs);
+MANTID_API_DLL WorkspaceExpression
+operator/(const MatrixWorkspace_const_sptr &lhs,
+          const WorkspaceExpression &rhs);
+
+} // namespace API
+} // namespace Mantid
+
+#endif /* MANTID_API_WORKSPACEEXPRESSION_H_ */
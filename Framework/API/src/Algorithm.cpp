@@ -103,8 +103,9 @@ Algorithm::Algorithm()
       m_recordHistoryForChild(false), m_alwaysStoreInADS(true),
       m_runningAsync(false), m_running(false), m_rethrow(false),
       m_isAlgStartupLoggingEnabled(true), m_startChildProgress(0.),
-      m_endChildProgress(0.), m_algorithmID(this), m_singleGroup(-1),
-      m_groupsHaveSimilarNames(false), m_inputWorkspaceHistories(),
+      m_endChildProgress(0.), m_algorithmID(this), m_isManaged(false),
+      m_singleGroup(-1), m_groupsHaveSimilarNames(false),
+      m_inputWorkspaceHistories(),
       m_communicator(std::make_unique<Parallel::Communicator>()) {}
 
 /// Virtual destructor
@@ -492,7 +493,12 @@ void Algorithm::unlockWorkspaces() {
 
 bool Algorithm::executeInternal() {
   Timer timer;
-  AlgorithmManager::Instance().notifyAlgorithmStarting(this->getAlgorithmID());
+  // Only algorithms created by the AlgorithmManager can be found there.
+  // Skipping the lookup for the others, which includes most child algorithms,
+  // avoids serialising them on the manager's mutex when they run in parallel.
+  if (m_isManaged)
+    AlgorithmManager::Instance().notifyAlgorithmStarting(
+        this->getAlgorithmID());
   {
     DeprecatedAlgorithm *depo = dynamic_cast<DeprecatedAlgorithm *>(this);
     if (depo != nullptr)
@@ -651,14 +657,15 @@ bool Algorithm::executeInternal() {
       setExecuted(true);
 
       // Log that execution has completed.
-      getLogger().debug(
-          "Time to validate properties: " +
-          std::to_string(timingPropertyValidation) + " seconds\n" +
-          "Time for other input validation: " +
-          std::to_string(timingInputValidation) + " seconds\n" +
-          "Time for other initialization: " + std::to_string(timingInit) +
-          " seconds\n" + "Time to run exec: " + std::to_string(timingExec) +
-          " seconds\n");
+      if (getLogger().is(Logger::Priority::PRIO_DEBUG))
+        getLogger().debug(
+            "Time to validate properties: " +
+            std::to_string(timingPropertyValidation) + " seconds\n" +
+            "Time for other input validation: " +
+            std::to_string(timingInputValidation) + " seconds\n" +
+            "Time for other initialization: " + std::to_string(timingInit) +
+            " seconds\n" + "Time to run exec: " + std::to_string(timingExec) +
+            " seconds\n");
       reportCompleted(duration);
     } catch (std::runtime_error &ex) {
       this->unlockWorkspaces();
@@ -988,6 +995,8 @@ void Algorithm::initializeFromProxy(const AlgorithmProxy &proxy) {
   initialize();
   copyPropertiesFrom(proxy);
   m_algorithmID = proxy.getAlgorithmID();
+  // Proxies are only created by the AlgorithmManager
+  m_isManaged = true;
   setLogging(proxy.isLogging());
   setLoggingOffset(proxy.getLoggingOffset());
   setAlgStartupLogging(proxy.getAlgStartupLogging());
@@ -1399,14 +1408,21 @@ bool Algorithm::processGroups() {
     }
   }
 
+  const bool parallel = processGroupsInParallel() && m_groupSize > 1;
   double progress_proportion = 1.0 / static_cast<double>(m_groupSize);
-  // Go through each entry in the input group(s)
-  for (size_t entry = 0; entry < m_groupSize; entry++) {
-    // use create Child Algorithm that look like this one
-    Algorithm_sptr alg_sptr = this->createChildAlgorithm(
-        this->name(), progress_proportion * static_cast<double>(entry),
-        progress_proportion * (1 + static_cast<double>(entry)),
-        this->isLogging(), this->version());
+  std::vector<std::vector<std::string>> outputWSNames(m_groupSize);
+  // ---------- Create the child algorithm for an entry ------------------
+  auto setUpEntry = [&](const size_t entry) {
+    // use create Child Algorithm that look like this one. Concurrent children
+    // cannot share the progress range of this algorithm, so progress is
+    // reported here as each one finishes instead.
+    const double startProgress =
+        parallel ? -1. : progress_proportion * static_cast<double>(entry);
+    const double endProgress =
+        parallel ? -1. : progress_proportion * (1 + static_cast<double>(entry));
+    Algorithm_sptr alg_sptr =
+        this->createChildAlgorithm(this->name(), startProgress, endProgress,
+                                   this->isLogging(), this->version());
     // Make a child algorithm and turn off history recording for it, but always
     // store result in the ADS
     alg_sptr->setChild(true);
@@ -1453,7 +1469,8 @@ bool Algorithm::processGroups() {
       } // not an empty (i.e. optional) input
     }   // for each InputWorkspace property
 
-    std::vector<std::string> outputWSNames(m_pureOutputWorkspaceProps.size());
+    auto &entryOutputNames = outputWSNames[entry];
+    entryOutputNames.resize(m_pureOutputWorkspaceProps.size());
     // ---------- Set all the output workspaces ----------------------------
     for (size_t owp = 0; owp < m_pureOutputWorkspaceProps.size(); owp++) {
       if (Property *prop =
@@ -1490,16 +1507,19 @@ bool Algorithm::processGroups() {
         // Set in the output
         alg->setPropertyValue(prop->name(), outName);
 
-        outputWSNames[owp] = outName;
+        entryOutputNames[owp] = outName;
       } else {
         throw std::logic_error("Found a Workspace property which doesn't "
                                "inherit from Property.");
       }
     } // for each OutputWorkspace property
+    return alg_sptr;
+  };
 
-    // ------------ Execute the algo --------------
+  // ------------ Execute the algo --------------
+  auto executeEntry = [this](IAlgorithm &alg, const size_t entry) {
     try {
-      alg->execute();
+      alg.execute();
     } catch (std::exception &e) {
       std::ostringstream msg;
       msg << "Execution of " << this->name() << " for group entry "
@@ -1507,20 +1527,59 @@ bool Algorithm::processGroups() {
       msg << e.what(); // Add original message
       throw std::runtime_error(msg.str());
     }
-
-    // ------------ Fill in the output workspace group ------------------
-    // this has to be done after execute() because a workspace must exist
-    // when it is added to a group
+  };
+  // ------------ Fill in the output workspace group ------------------
+  // this has to be done after execute() because a workspace must exist
+  // when it is added to a group
+  auto addOutputs = [this, &outGroups, &outputWSNames](const size_t entry) {
     for (size_t owp = 0; owp < m_pureOutputWorkspaceProps.size(); owp++) {
       Property *prop =
           dynamic_cast<Property *>(m_pureOutputWorkspaceProps[owp]);
       if (prop && prop->value().empty())
         continue;
       // And add it to the output group
-      outGroups[owp]->add(outputWSNames[owp]);
+      outGroups[owp]->add(outputWSNames[entry][owp]);
     }
+  };
 
-  } // for each entry in each group
+  if (parallel) {
+    // The children are set up in order, as setting their properties uses the
+    // ADS, and then executed concurrently
+    std::vector<Algorithm_sptr> algorithms(m_groupSize);
+    for (size_t entry = 0; entry < m_groupSize; entry++)
+      algorithms[entry] = setUpEntry(entry);
+    // Keep the error of the first failing entry so the message does not
+    // depend on scheduling
+    std::vector<std::string> errors(m_groupSize);
+    size_t completed(0);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < static_cast<int64_t>(m_groupSize); ++i) {
+      const auto entry = static_cast<size_t>(i);
+      try {
+        executeEntry(*algorithms[entry], entry);
+      } catch (std::exception &e) {
+        errors[entry] = e.what();
+      }
+      // Release the child, and the memory it holds, as soon as it is done
+      algorithms[entry].reset();
+      PARALLEL_CRITICAL(processGroups_progress) {
+        ++completed;
+        progress(progress_proportion * static_cast<double>(completed));
+      }
+    }
+    for (const auto &error : errors) {
+      if (!error.empty())
+        throw std::runtime_error(error);
+    }
+    for (size_t entry = 0; entry < m_groupSize; entry++)
+      addOutputs(entry);
+  } else {
+    // Go through each entry in the input group(s)
+    for (size_t entry = 0; entry < m_groupSize; entry++) {
+      executeEntry(*setUpEntry(entry), entry);
+      addOutputs(entry);
+    }
+  }
 
   // restore group notifications
   for (auto &outGroup : outGroups) {
@@ -1750,7 +1809,7 @@ void Algorithm::reportCompleted(const double &duration,
     }
   }
 
-  else {
+  else if (getLogger().is(Logger::Priority::PRIO_DEBUG)) {
     getLogger().debug() << name() << " finished with isChild = " << isChild()
                         << '\n';
   }
@@ -0,0 +1,435 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/WorkspaceExpression.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/WorkspaceFactory.h"
+#include "MantidAPI/WorkspaceHistory.h"
+#include "MantidAPI/WorkspaceOpOverloads.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Mantid {
+namespace API {
+
+/// A node of the expression tree: either a leaf holding a workspace or a
+/// number, or a binary operation on two sub-expressions
+struct WorkspaceExpression::Node {
+  enum class Type { Workspace, Value, Plus, Minus, Multiply, Divide };
+  Type type;
+  MatrixWorkspace_const_sptr workspace;
+  double value{0.0};
+  std::shared_ptr<const Node> lhs;
+  std::shared_ptr<const Node> rhs;
+};
+
+namespace {
+using Node = WorkspaceExpression::Node;
+
+/// A leaf of the expression. Single values have a null workspace.
+struct Leaf {
+  MatrixWorkspace_const_sptr workspace;
+  double value;
+  double variance;
+};
+
+/// One step of the expression in postfix order. For leaves, the index of the
+/// leaf to push onto the stack.
+struct Instruction {
+  Node::Type type;
+  size_t leaf;
+};
+
+/// The expression flattened so that it can be evaluated with a stack
+struct Program {
+  std::vector<Instruction> instructions;
+  std::vector<Leaf> leaves;
+  size_t depth{0};
+};
+
+/// An entry on the evaluation stack. A stride of zero means that the single
+/// value applies to every bin.
+struct Operand {
+  const double *y;
+  const double *variance;
+  size_t stride;
+};
+
+/// Append the instructions for a sub-expression to the program
+size_t compile(const Node &node, Program &program, size_t depth) {
+  switch (node.type) {
+  case Node::Type::Workspace:
+    program.leaves.push_back({node.workspace, 0.0, 0.0});
+    break;
+  case Node::Type::Value:
+    program.leaves.push_back({nullptr, node.value, 0.0});
+    break;
+  default: {
+    const auto lhsDepth = compile(*node.lhs, program, depth);
+    const auto rhsDepth = compile(*node.rhs, program, depth + 1);
+    program.instructions.push_back({node.type, 0});
+    return std::max(lhsDepth, rhsDepth);
+  }
+  }
+  program.instructions.push_back({node.type, program.leaves.size() - 1});
+  return depth + 1;
+}
+
+bool isSingleValued(const MatrixWorkspace &ws) {
+  return ws.getNumberHistograms() == 1 && ws.blocksize() == 1;
+}
+
+/**
+ * Combine two operands bin by bin
+ * @param lhs :: The left-hand operand
+ * @param rhs :: The right-hand operand
+ * @param y :: Output for the values
+ * @param variance :: Output for the variances
+ * @param nBins :: The number of bins to compute
+ * @param op :: Computes the value and variance of a single bin
+ */
+template <typename Op>
+void combine(const Operand &lhs, const Operand &rhs, double *y,
+             double *variance, const size_t nBins, Op op) {
+  for (size_t j = 0; j < nBins; ++j) {
+    op(lhs.y[j * lhs.stride], lhs.variance[j * lhs.stride],
+       rhs.y[j * rhs.stride], rhs.variance[j * rhs.stride], y[j],
+       variance[j]);
+  }
+}
+
+/**
+ * Apply a binary operation. The errors are propagated as in the Plus, Minus,
+ * Multiply and Divide algorithms.
+ */
+void apply(const Node::Type type, const Operand &lhs, const Operand &rhs,
+           double *y, double *variance, const size_t nBins) {
+  switch (type) {
+  case Node::Type::Plus:
+    combine(lhs, rhs, y, variance, nBins,
+            [](double a, double va, double b, double vb, double &c,
+               double &vc) {
+              c = a + b;
+              vc = va + vb;
+            });
+    break;
+  case Node::Type::Minus:
+    combine(lhs, rhs, y, variance, nBins,
+            [](double a, double va, double b, double vb, double &c,
+               double &vc) {
+              c = a - b;
+              vc = va + vb;
+            });
+    break;
+  case Node::Type::Multiply:
+    combine(lhs, rhs, y, variance, nBins,
+            [](double a, double va, double b, double vb, double &c,
+               double &vc) {
+              c = a * b;
+              vc = va * b * b + vb * a * a;
+            });
+    break;
+  case Node::Type::Divide:
+    combine(lhs, rhs, y, variance, nBins,
+            [](double a, double va, double b, double vb, double &c,
+               double &vc) {
+              const double bSq = b * b;
+              c = a / b;
+              vc = (va + a * a * vb / bSq) / bSq;
+            });
+    break;
+  default:
+    throw std::logic_error("WorkspaceExpression: unknown operation");
+  }
+}
+
+std::shared_ptr<const Node> makeNode(const Node::Type type,
+                                     std::shared_ptr<const Node> lhs,
+                                     std::shared_ptr<const Node> rhs) {
+  auto node = std::make_shared<Node>();
+  node->type = type;
+  node->lhs = std::move(lhs);
+  node->rhs = std::move(rhs);
+  return node;
+}
+} // namespace
+
+/// Create an expression consisting of a single workspace
+WorkspaceExpression::WorkspaceExpression(const MatrixWorkspace_sptr &workspace)
+    : WorkspaceExpression(MatrixWorkspace_const_sptr(workspace)) {}
+
+/// Create an expression consisting of a single workspace
+WorkspaceExpression::WorkspaceExpression(
+    const MatrixWorkspace_const_sptr &workspace) {
+  if (!workspace)
+    throw std::invalid_argument("WorkspaceExpression: null workspace");
+  auto node = std::make_shared<Node>();
+  node->type = Node::Type::Workspace;
+  node->workspace = workspace;
+  m_root = std::move(node);
+}
+
+/// Create an expression consisting of a number with zero error
+WorkspaceExpression::WorkspaceExpression(const double value) {
+  auto node = std::make_shared<Node>();
+  node->type = Node::Type::Value;
+  node->value = value;
+  m_root = std::move(node);
+}
+
+WorkspaceExpression::WorkspaceExpression(std::shared_ptr<const Node> root)
+    : m_root(std::move(root)) {}
+
+/**
+ * Evaluate the expression.
+ *
+ * The result is computed spectrum by spectrum: every operation is applied to
+ * a whole spectrum before moving on to the next one, so intermediate results
+ * only need buffers the size of a spectrum. The history of the output is the
+ * merged history of the workspaces in the expression.
+ * @return A new workspace holding the result
+ * @throws std::invalid_argument if the expression contains no workspace or
+ * the workspaces have different shapes or binning
+ */
+MatrixWorkspace_sptr WorkspaceExpression::evaluate() const {
+  Program program;
+  program.depth = compile(*m_root, program, 0);
+
+  // The output is shaped like the first workspace that is not a single value
+  MatrixWorkspace_const_sptr parent;
+  for (const auto &leaf : program.leaves) {
+    if (leaf.workspace && (!parent || (isSingleValued(*parent) &&
+                                       !isSingleValued(*leaf.workspace))))
+      parent = leaf.workspace;
+  }
+  if (!parent)
+    throw std::invalid_argument(
+        "WorkspaceExpression: the expression contains no workspace");
+
+  const size_t nHist = parent->getNumberHistograms();
+  const size_t nBins = parent->blocksize();
+  std::vector<MatrixWorkspace_const_sptr> workspaces;
+  for (auto &leaf : program.leaves) {
+    if (!leaf.workspace)
+      continue;
+    if (std::find(workspaces.begin(), workspaces.end(), leaf.workspace) ==
+        workspaces.end())
+      workspaces.emplace_back(leaf.workspace);
+    if (leaf.workspace == parent)
+      continue;
+    if (isSingleValued(*leaf.workspace)) {
+      leaf.value = leaf.workspace->y(0)[0];
+      leaf.variance = leaf.workspace->e(0)[0] * leaf.workspace->e(0)[0];
+      leaf.workspace = nullptr;
+    } else if (leaf.workspace->getNumberHistograms() != nHist ||
+               leaf.workspace->blocksize() != nBins ||
+               !WorkspaceHelpers::matchingBins(*parent, *leaf.workspace)) {
+      throw std::invalid_argument(
+          "WorkspaceExpression: the workspaces " + parent->getName() +
+          " and " + leaf.workspace->getName() +
+          " do not have the same shape and binning");
+    }
+  }
+
+  MatrixWorkspace_sptr out = WorkspaceFactory::Instance().create(parent);
+  bool threadSafe = out->threadSafe();
+  for (const auto &ws : workspaces)
+    threadSafe = threadSafe && ws->threadSafe();
+
+  PARALLEL_FOR_IF(threadSafe)
+  for (int64_t i = 0; i < static_cast<int64_t>(nHist); ++i) {
+    const auto index = static_cast<size_t>(i);
+    // One value and one variance buffer for each level of the stack. A
+    // result replaces the left-hand operand at its level.
+    std::vector<std::vector<double>> values(program.depth,
+                                            std::vector<double>(nBins));
+    std::vector<std::vector<double>> variances(program.depth,
+                                               std::vector<double>(nBins));
+    // Keep the data of the workspaces alive while the stack points into it
+    std::vector<Kernel::cow_ptr<HistogramData::HistogramY>> ys;
+    std::vector<Operand> stack;
+    stack.reserve(program.depth);
+    for (const auto &instruction : program.instructions) {
+      const size_t level = stack.size();
+      if (instruction.type == Node::Type::Workspace ||
+          instruction.type == Node::Type::Value) {
+        const auto &leaf = program.leaves[instruction.leaf];
+        if (!leaf.workspace) {
+          stack.push_back({&leaf.value, &leaf.variance, 0});
+          continue;
+        }
+        ys.emplace_back(leaf.workspace->sharedY(index));
+        const auto e = leaf.workspace->sharedE(index);
+        std::transform(e->cbegin(), e->cend(), variances[level].begin(),
+                       [](const double error) { return error * error; });
+        stack.push_back({ys.back()->rawData().data(),
+                         variances[level].data(), 1});
+        continue;
+      }
+      const auto rhs = stack.back();
+      stack.pop_back();
+      auto lhs = stack.back();
+      // A single value on the left may live in the buffer the result is
+      // written to, so take a copy before it is overwritten
+      double lhsValue, lhsVariance;
+      if (lhs.stride == 0) {
+        lhsValue = *lhs.y;
+        lhsVariance = *lhs.variance;
+        lhs = {&lhsValue, &lhsVariance, 0};
+      }
+      const size_t stride = std::max(lhs.stride, rhs.stride);
+      apply(instruction.type, lhs, rhs, values[level - 2].data(),
+            variances[level - 2].data(), stride == 0 ? 1 : nBins);
+      stack.back() = {values[level - 2].data(), variances[level - 2].data(),
+                      stride};
+    }
+
+    const auto &result = stack.front();
+    auto &y = out->mutableY(index);
+    auto &e = out->mutableE(index);
+    for (size_t j = 0; j < nBins; ++j) {
+      y[j] = result.y[j * result.stride];
+      e[j] = std::sqrt(result.variance[j * result.stride]);
+    }
+    out->setSharedX(index, parent->sharedX(index));
+    if (parent->hasDx(index))
+      out->setSharedDx(index, parent->sharedDx(index));
+  }
+
+  for (const auto &ws : workspaces)
+    out->history().addHistory(ws->getHistory());
+  return out;
+}
+
+/// Add two expressions
+WorkspaceExpression operator+(const WorkspaceExpression &lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(
+      makeNode(WorkspaceExpression::Node::Type::Plus, lhs.m_root, rhs.m_root));
+}
+
+/// Subtract one expression from another
+WorkspaceExpression operator-(const WorkspaceExpression &lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(
+      makeNode(WorkspaceExpression::Node::Type::Minus, lhs.m_root, rhs.m_root));
+}
+
+/// Multiply two expressions
+WorkspaceExpression operator*(const WorkspaceExpression &lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(makeNode(WorkspaceExpression::Node::Type::Multiply,
+                                      lhs.m_root, rhs.m_root));
+}
+
+/// Divide one expression by another
+WorkspaceExpression operator/(const WorkspaceExpression &lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(makeNode(WorkspaceExpression::Node::Type::Divide,
+                                      lhs.m_root, rhs.m_root));
+}
+
+/// Add a number to an expression
+WorkspaceExpression operator+(const WorkspaceExpression &lhs,
+                              const double rhs) {
+  return lhs + WorkspaceExpression(rhs);
+}
+
+/// Add an expression to a number
+WorkspaceExpression operator+(const double lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) + rhs;
+}
+
+/// Add a workspace to an expression
+WorkspaceExpression operator+(const WorkspaceExpression &lhs,
+                              const MatrixWorkspace_const_sptr &rhs) {
+  return lhs + WorkspaceExpression(rhs);
+}
+
+/// Add an expression to a workspace
+WorkspaceExpression operator+(const MatrixWorkspace_const_sptr &lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) + rhs;
+}
+
+/// Subtract a number from an expression
+WorkspaceExpression operator-(const WorkspaceExpression &lhs,
+                              const double rhs) {
+  return lhs - WorkspaceExpression(rhs);
+}
+
+/// Subtract an expression from a number
+WorkspaceExpression operator-(const double lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) - rhs;
+}
+
+/// Subtract a workspace from an expression
+WorkspaceExpression operator-(const WorkspaceExpression &lhs,
+                              const MatrixWorkspace_const_sptr &rhs) {
+  return lhs - WorkspaceExpression(rhs);
+}
+
+/// Subtract an expression from a workspace
+WorkspaceExpression operator-(const MatrixWorkspace_const_sptr &lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) - rhs;
+}
+
+/// Multiply an expression by a number
+WorkspaceExpression operator*(const WorkspaceExpression &lhs,
+                              const double rhs) {
+  return lhs * WorkspaceExpression(rhs);
+}
+
+/// Multiply a number by an expression
+WorkspaceExpression operator*(const double lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) * rhs;
+}
+
+/// Multiply an expression by a workspace
+WorkspaceExpression operator*(const WorkspaceExpression &lhs,
+                              const MatrixWorkspace_const_sptr &rhs) {
+  return lhs * WorkspaceExpression(rhs);
+}
+
+/// Multiply a workspace by an expression
+WorkspaceExpression operator*(const MatrixWorkspace_const_sptr &lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) * rhs;
+}
+
+/// Divide an expression by a number
+WorkspaceExpression operator/(const WorkspaceExpression &lhs,
+                              const double rhs) {
+  return lhs / WorkspaceExpression(rhs);
+}
+
+/// Divide a number by an expression
+WorkspaceExpression operator/(const double lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) / rhs;
+}
+
+/// Divide an expression by a workspace
+WorkspaceExpression operator/(const WorkspaceExpression &lhs,
+                              const MatrixWorkspace_const_sptr &rhs) {
+  return lhs / WorkspaceExpression(rhs);
+}
+
+/// Divide a workspace by an expression
+WorkspaceExpression operator/(const MatrixWorkspace_const_sptr &lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(lhs) / rhs;
+}
+
+} // namespace API
+} // namespace Mantid
@@ -23,6 +23,10 @@
 #include "Poco/DateTime.h"
 #include <Poco/DateTimeParser.h>
 
+#include <algorithm>
+#include <iterator>
+#include <unordered_set>
+
 using Mantid::Kernel::EnvironmentHistory;
 using boost::algorithm::split;
 
@@ -33,7 +37,7 @@ namespace {
 Kernel::Logger g_log("WorkspaceHistory");
 struct AlgorithmHistorySearch {
   bool operator()(const AlgorithmHistory_sptr &lhs,
-                  const AlgorithmHistory_sptr &rhs) {
+                  const AlgorithmHistory_sptr &rhs) const {
     return (*lhs) < (*rhs);
   }
 };
@@ -85,29 +89,54 @@ void WorkspaceHistory::addHistory(const WorkspaceHistory &otherHistory) {
     return;
   }
 
-  // Merge the histories
   const AlgorithmHistories &otherAlgorithms =
       otherHistory.getAlgorithmHistories();
+  if (otherAlgorithms.empty())
+    return;
 
-  for (const auto &algHistory : otherAlgorithms) {
-    this->addHistory(algHistory);
+  // Both lists are kept in execution order so they can be merged in linear
+  // time rather than re-sorting the combined history
+  AlgorithmHistorySearch byExecCount;
+  if (!std::is_sorted(m_algorithms.cbegin(), m_algorithms.cend(),
+                      byExecCount))
+    std::stable_sort(m_algorithms.begin(), m_algorithms.end(), byExecCount);
+  AlgorithmHistories merged;
+  merged.reserve(m_algorithms.size() + otherAlgorithms.size());
+  if (std::is_sorted(otherAlgorithms.cbegin(), otherAlgorithms.cend(),
+                     byExecCount)) {
+    std::merge(m_algorithms.cbegin(), m_algorithms.cend(),
+               otherAlgorithms.cbegin(), otherAlgorithms.cend(),
+               std::back_inserter(merged), byExecCount);
+  } else {
+    AlgorithmHistories otherSorted(otherAlgorithms);
+    std::stable_sort(otherSorted.begin(), otherSorted.end(), byExecCount);
+    std::merge(m_algorithms.cbegin(), m_algorithms.cend(), otherSorted.cbegin(),
+               otherSorted.cend(), std::back_inserter(merged), byExecCount);
   }
 
+  // Histories shared by both workspaces appear twice with the same execution
+  // count, so duplicates only need to be looked for among the entries of each
+  // execution count.
   using UniqueAlgorithmHistories =
       std::unordered_set<AlgorithmHistory_sptr, AlgorithmHistoryHasher,
                          AlgorithmHistoryComparator>;
-  // It is faster to default construct a set/unordered_set and insert the
-  // elements than use the range-based constructor directly.
-  // See https://stackoverflow.com/a/24477023:
-  //   "the constructor actually construct a new node for every element, before
-  //   checking its value to determine if it should actually be inserted."
+  m_algorithms.clear();
+  m_algorithms.reserve(merged.size());
   UniqueAlgorithmHistories uniqueHistories;
-  for (const auto &algorithmHistory : m_algorithms) {
-    uniqueHistories.insert(algorithmHistory);
+  for (auto first = merged.cbegin(); first != merged.cend();) {
+    const auto last =
+        std::upper_bound(first, merged.cend(), *first, byExecCount);
+    if (std::next(first) == last) {
+      m_algorithms.emplace_back(*first);
+    } else {
+      uniqueHistories.clear();
+      std::copy_if(first, last, std::back_inserter(m_algorithms),
+                   [&uniqueHistories](const AlgorithmHistory_sptr &history) {
+                     return uniqueHistories.insert(history).second;
+                   });
+    }
+    first = last;
   }
-  m_algorithms.assign(std::begin(uniqueHistories), std::end(uniqueHistories));
-  std::sort(std::begin(m_algorithms), std::end(m_algorithms),
-            AlgorithmHistorySearch());
 }
 
 /// Append an AlgorithmHistory to this WorkspaceHistory
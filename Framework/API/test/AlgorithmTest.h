@@ -78,6 +78,15 @@ public:
 };
 DECLARE_ALGORITHM(StubbedWorkspaceAlgorithm)
 
+class ParallelGroupAlgorithm : public StubbedWorkspaceAlgorithm {
+public:
+  const std::string name() const override { return "ParallelGroupAlgorithm"; }
+
+protected:
+  bool processGroupsInParallel() const override { return true; }
+};
+DECLARE_ALGORITHM(ParallelGroupAlgorithm)
+
 class StubbedWorkspaceAlgorithm2 : public Algorithm {
 public:
   StubbedWorkspaceAlgorithm2() : Algorithm() {}
@@ -169,6 +178,17 @@ const std::string FailingAlgorithm::FAIL_MSG("Algorithm failed as requested");
 
 DECLARE_ALGORITHM(FailingAlgorithm)
 
+class ParallelFailingAlgorithm : public FailingAlgorithm {
+public:
+  const std::string name() const override {
+    return "ParallelFailingAlgorithm";
+  }
+
+protected:
+  bool processGroupsInParallel() const override { return true; }
+};
+DECLARE_ALGORITHM(ParallelFailingAlgorithm)
+
 class IndexingAlgorithm : public Algorithm {
 public:
   const std::string name() const override { return "IndexingAlgorithm"; }
@@ -763,6 +783,53 @@ public:
     }
   }
 
+  void test_processGroups_in_parallel_keeps_the_order_of_the_entries() {
+    std::string names;
+    for (int i = 1; i <= 20; ++i)
+      names += (i > 1 ? ",A_" : "A_") + std::to_string(i);
+    makeWorkspaceGroup("A", names);
+
+    ParallelGroupAlgorithm alg;
+    alg.initialize();
+    alg.setPropertyValue("InputWorkspace1", "A");
+    alg.setPropertyValue("Number", "234");
+    alg.setPropertyValue("OutputWorkspace1", "D");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    auto group =
+        AnalysisDataService::Instance().retrieveWS<WorkspaceGroup>("D");
+    TS_ASSERT_EQUALS(group->getNumberOfEntries(), 20);
+    for (int i = 0; i < group->getNumberOfEntries(); ++i) {
+      const auto ws =
+          boost::dynamic_pointer_cast<MatrixWorkspace>(group->getItem(i));
+      const auto suffix = std::to_string(i + 1);
+      TS_ASSERT_EQUALS(ws->getName(), "D_" + suffix);
+      TS_ASSERT_EQUALS(ws->getTitle(), "A_" + suffix + "++");
+      TS_ASSERT_EQUALS(ws->readY(0)[0], 234);
+    }
+  }
+
+  void test_processGroups_in_parallel_reports_the_failing_entry() {
+    makeWorkspaceGroup("A", "A_1,A_2,A_3,A_4");
+
+    ParallelFailingAlgorithm alg;
+    alg.initialize();
+    alg.setRethrows(true);
+    alg.setLogging(false);
+    alg.setPropertyValue("InputWorkspace", "A");
+    alg.setPropertyValue("WsNameToFail", "A_3");
+
+    try {
+      alg.execute();
+      TS_FAIL("Exception wasn't thrown");
+    } catch (std::runtime_error &e) {
+      std::string msg(e.what());
+      TS_ASSERT(msg.find("group entry 3") != std::string::npos);
+      TS_ASSERT(msg.find(FailingAlgorithm::FAIL_MSG) != std::string::npos);
+    }
+  }
+
   /// Rewrite first input group
   void test_processGroups_rewriteFirstGroup() {
     WorkspaceGroup_sptr group =
@@ -1023,4 +1090,33 @@ private:
   MatrixWorkspace_sptr ws3;
 };
 
+class AlgorithmTestPerformance : public CxxTest::TestSuite {
+public:
+  static AlgorithmTestPerformance *createSuite() {
+    return new AlgorithmTestPerformance();
+  }
+  static void destroySuite(AlgorithmTestPerformance *suite) { delete suite; }
+
+  AlgorithmTestPerformance() {
+    m_parent.initialize();
+    m_input = boost::make_shared<WorkspaceTester>();
+    m_input->initialize(1, 1, 1);
+  }
+
+  /// Cost of creating and running a child algorithm with almost no work to do
+  void test_create_and_execute_child_algorithm_10000_times() {
+    for (int i = 0; i < 10000; ++i) {
+      auto child = m_parent.createChildAlgorithm("StubbedWorkspaceAlgorithm");
+      child->setProperty("InputWorkspace1", m_input);
+      child->setProperty("Number", static_cast<double>(i));
+      child->execute();
+      MatrixWorkspace_sptr output = child->getProperty("OutputWorkspace1");
+    }
+  }
+
+private:
+  StubbedWorkspaceAlgorithm m_parent;
+  MatrixWorkspace_sptr m_input;
+};
+
 #endif /*ALGORITHMTEST_H_*/
@@ -0,0 +1,275 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_WORKSPACEEXPRESSIONTEST_H_
+#define MANTID_API_WORKSPACEEXPRESSIONTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/WorkspaceExpression.h"
+#include "MantidAPI/WorkspaceFactory.h"
+#include "MantidTestHelpers/FakeObjects.h"
+
+#include <cmath>
+#include <functional>
+
+using namespace Mantid::API;
+
+namespace {
+/// A bin value with its variance
+struct Measurement {
+  double value;
+  double variance;
+};
+
+// The error propagation of the Plus, Minus, Multiply and Divide algorithms
+Measurement plus(const Measurement &a, const Measurement &b) {
+  return {a.value + b.value, a.variance + b.variance};
+}
+Measurement minus(const Measurement &a, const Measurement &b) {
+  return {a.value - b.value, a.variance + b.variance};
+}
+Measurement times(const Measurement &a, const Measurement &b) {
+  return {a.value * b.value, a.variance * b.value * b.value +
+                                 b.variance * a.value * a.value};
+}
+Measurement divide(const Measurement &a, const Measurement &b) {
+  const double bSq = b.value * b.value;
+  return {a.value / b.value,
+          (a.variance + a.value * a.value * b.variance / bSq) / bSq};
+}
+
+using BinFunction = std::function<double(const double, const size_t)>;
+
+MatrixWorkspace_sptr makeWorkspace(const size_t nSpec, const BinFunction &y,
+                                   const BinFunction &e) {
+  constexpr size_t nBins = 10;
+  auto ws = WorkspaceFactory::Instance().create("WorkspaceTester", nSpec,
+                                                nBins + 1, nBins);
+  for (size_t i = 0; i < nSpec; ++i) {
+    auto &x = ws->mutableX(i);
+    for (size_t j = 0; j <= nBins; ++j)
+      x[j] = static_cast<double>(j);
+    auto &yValues = ws->mutableY(i);
+    auto &eValues = ws->mutableE(i);
+    for (size_t j = 0; j < nBins; ++j) {
+      const double centre = static_cast<double>(j) + 0.5;
+      yValues[j] = y(centre, i);
+      eValues[j] = e(centre, i);
+    }
+  }
+  return ws;
+}
+MatrixWorkspace_sptr makeSample(const size_t nSpec = 3) {
+  return makeWorkspace(
+      nSpec,
+      [](const double x, const size_t spec) {
+        return 10.0 + x + static_cast<double>(spec);
+      },
+      [](const double x, const size_t) { return 0.1 * x + 1.0; });
+}
+MatrixWorkspace_sptr makeCan(const size_t nSpec = 3) {
+  return makeWorkspace(
+      nSpec, [](const double x, const size_t) { return 2.0 + 0.5 * x; },
+      [](const double x, const size_t) { return std::sqrt(2.0 + 0.5 * x); });
+}
+MatrixWorkspace_sptr makeVanadium(const size_t nSpec = 3) {
+  return makeWorkspace(nSpec,
+                       [](const double x, const size_t spec) {
+                         return 3.0 + 0.25 * x * static_cast<double>(spec + 1);
+                       },
+                       [](const double, const size_t) { return 0.5; });
+}
+MatrixWorkspace_sptr makeSingleValue(const double value, const double error) {
+  auto ws = WorkspaceFactory::Instance().create("WorkspaceTester", 1, 1, 1);
+  ws->mutableY(0)[0] = value;
+  ws->mutableE(0)[0] = error;
+  return ws;
+}
+
+Measurement bin(const MatrixWorkspace &ws, const size_t i, const size_t j) {
+  const double error = ws.e(i)[j];
+  return {ws.y(i)[j], error * error};
+}
+} // namespace
+
+class WorkspaceExpressionTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static WorkspaceExpressionTest *createSuite() {
+    return new WorkspaceExpressionTest();
+  }
+  static void destroySuite(WorkspaceExpressionTest *suite) { delete suite; }
+
+  void test_errors_are_propagated_as_in_binary_operations() {
+    auto sample = makeSample();
+    auto can = makeCan();
+    auto vanadium = makeVanadium();
+
+    WorkspaceExpression lazySample(sample), lazyCan(can);
+    auto lazy = ((lazySample - 0.9 * lazyCan) / vanadium * 2.0).evaluate();
+
+    assertBinsMatch(*lazy, *sample, [&](const size_t i, const size_t j) {
+      const auto scaledCan = times({0.9, 0.0}, bin(*can, i, j));
+      const auto subtracted = minus(bin(*sample, i, j), scaledCan);
+      return times(divide(subtracted, bin(*vanadium, i, j)), {2.0, 0.0});
+    });
+  }
+
+  void test_each_operation_propagates_its_errors() {
+    auto lhs = makeSample();
+    auto rhs = makeVanadium();
+    const WorkspaceExpression lazyLHS(lhs);
+    const WorkspaceExpression lazyRHS(rhs);
+    const auto lhsBin = [&](const size_t i, const size_t j) {
+      return bin(*lhs, i, j);
+    };
+    const auto rhsBin = [&](const size_t i, const size_t j) {
+      return bin(*rhs, i, j);
+    };
+    assertBinsMatch(*(lazyLHS + lazyRHS).evaluate(), *lhs,
+                    [&](const size_t i, const size_t j) {
+                      return plus(lhsBin(i, j), rhsBin(i, j));
+                    });
+    assertBinsMatch(*(lazyLHS - lazyRHS).evaluate(), *lhs,
+                    [&](const size_t i, const size_t j) {
+                      return minus(lhsBin(i, j), rhsBin(i, j));
+                    });
+    assertBinsMatch(*(lazyLHS * lazyRHS).evaluate(), *lhs,
+                    [&](const size_t i, const size_t j) {
+                      return times(lhsBin(i, j), rhsBin(i, j));
+                    });
+    assertBinsMatch(*(lazyLHS / lazyRHS).evaluate(), *lhs,
+                    [&](const size_t i, const size_t j) {
+                      return divide(lhsBin(i, j), rhsBin(i, j));
+                    });
+  }
+
+  void test_workspace_on_the_left_of_an_expression() {
+    auto sample = makeSample();
+    auto vanadium = makeVanadium();
+
+    auto lazy = (sample - WorkspaceExpression(vanadium) * 0.5).evaluate();
+
+    assertBinsMatch(*lazy, *sample, [&](const size_t i, const size_t j) {
+      return minus(bin(*sample, i, j),
+                   times(bin(*vanadium, i, j), {0.5, 0.0}));
+    });
+  }
+
+  void test_output_is_a_new_workspace_with_the_binning_of_the_input() {
+    auto sample = makeSample();
+    auto result = (WorkspaceExpression(sample) * 1.0).evaluate();
+    TS_ASSERT_DIFFERS(result, sample);
+    TS_ASSERT_EQUALS(result->getNumberHistograms(),
+                     sample->getNumberHistograms());
+    for (size_t i = 0; i < sample->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(&result->x(i), &sample->x(i));
+      TS_ASSERT_EQUALS(result->y(i).rawData(), sample->y(i).rawData());
+    }
+  }
+
+  void test_single_valued_workspace_is_applied_to_every_bin() {
+    auto sample = makeSample();
+    auto scale = makeSingleValue(2.0, 0.5);
+
+    auto lazy = (WorkspaceExpression(scale) * sample).evaluate();
+
+    assertBinsMatch(*lazy, *sample, [&](const size_t i, const size_t j) {
+      return times({2.0, 0.25}, bin(*sample, i, j));
+    });
+  }
+
+  void test_single_value_subexpression_on_the_left_of_a_workspace() {
+    auto sample = makeSample();
+
+    auto lazy = ((WorkspaceExpression(2.0) * 3.0) * sample).evaluate();
+
+    assertBinsMatch(*lazy, *sample, [&](const size_t i, const size_t j) {
+      return times({6.0, 0.0}, bin(*sample, i, j));
+    });
+  }
+
+  void test_expression_can_be_evaluated_more_than_once() {
+    auto sample = makeSample();
+    const auto expression = WorkspaceExpression(sample) + sample;
+    auto first = expression.evaluate();
+    auto second = expression.evaluate();
+    TS_ASSERT_DIFFERS(first, second);
+    assertBinsMatch(*second, *first, [&](const size_t i, const size_t j) {
+      return bin(*first, i, j);
+    });
+  }
+
+  void test_workspaces_with_different_shapes_throw() {
+    auto sample = makeSample(3);
+    auto can = makeCan(4);
+    TS_ASSERT_THROWS(
+        (WorkspaceExpression(sample) - WorkspaceExpression(can)).evaluate(),
+        const std::invalid_argument &);
+  }
+
+  void test_expression_without_a_workspace_throws() {
+    TS_ASSERT_THROWS((WorkspaceExpression(1.0) + 2.0).evaluate(),
+                     const std::invalid_argument &);
+  }
+
+  void test_null_workspace_throws() {
+    MatrixWorkspace_sptr null;
+    TS_ASSERT_THROWS(WorkspaceExpression{null}, const std::invalid_argument &);
+  }
+
+private:
+  /// Check every bin of actual against the expected value and error
+  template <typename Expected>
+  void assertBinsMatch(const MatrixWorkspace &actual,
+                       const MatrixWorkspace &shape, Expected expected) {
+    TS_ASSERT_EQUALS(actual.getNumberHistograms(), shape.getNumberHistograms());
+    TS_ASSERT_EQUALS(actual.blocksize(), shape.blocksize());
+    for (size_t i = 0; i < shape.getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(actual.x(i).rawData(), shape.x(i).rawData());
+      for (size_t j = 0; j < shape.blocksize(); ++j) {
+        const auto expectedBin = expected(i, j);
+        TS_ASSERT_DELTA(actual.y(i)[j], expectedBin.value, 1e-12);
+        TS_ASSERT_DELTA(actual.e(i)[j], std::sqrt(expectedBin.variance),
+                        1e-12);
+      }
+    }
+  }
+};
+
+class WorkspaceExpressionTestPerformance : public CxxTest::TestSuite {
+public:
+  static WorkspaceExpressionTestPerformance *createSuite() {
+    return new WorkspaceExpressionTestPerformance();
+  }
+  static void destroySuite(WorkspaceExpressionTestPerformance *suite) {
+    delete suite;
+  }
+
+  WorkspaceExpressionTestPerformance() {
+    m_sample = WorkspaceFactory::Instance().create("WorkspaceTester", 10000,
+                                                   2001, 2000);
+    m_can = WorkspaceFactory::Instance().create("WorkspaceTester", 10000, 2001,
+                                                2000);
+    m_vanadium = WorkspaceFactory::Instance().create("WorkspaceTester", 10000,
+                                                     2001, 2000);
+  }
+
+  void test_fused_expression() {
+    WorkspaceExpression sample(m_sample), can(m_can);
+    auto result = ((sample - 0.9 * can) / m_vanadium * 2.0).evaluate();
+  }
+
+private:
+  MatrixWorkspace_sptr m_sample;
+  MatrixWorkspace_sptr m_can;
+  MatrixWorkspace_sptr m_vanadium;
+};
+
+#endif /* MANTID_API_WORKSPACEEXPRESSIONTEST_H_ */
@@ -131,6 +131,36 @@ public:
     Mantid::API::AlgorithmFactory::Instance().unsubscribe("SimpleSum2", 1);
   }
 
+  void test_Adding_History_Keeps_Execution_Order_Without_Duplicates() {
+    using Mantid::Types::Core::DateAndTime;
+    const auto start = DateAndTime::defaultTime();
+    auto shared = boost::make_shared<AlgorithmHistory>(
+        "Shared", 1, "0c4e8a0c-6b71-4bba-8f4e-96e4b7e1d7a1", start, -1.0, 1);
+    auto first = boost::make_shared<AlgorithmHistory>(
+        "First", 1, "5d1a3c2e-2f0c-4f57-b2d4-2a0a3f0e8c11", start, -1.0, 2);
+    auto second = boost::make_shared<AlgorithmHistory>(
+        "Second", 1, "9b7e6f5d-3c1a-4e2b-8d9f-0a1b2c3d4e5f", start, -1.0, 3);
+    auto third = boost::make_shared<AlgorithmHistory>(
+        "Third", 1, "e3f1d2c4-b5a6-4978-8a9b-c0d1e2f3a4b5", start, -1.0, 4);
+
+    WorkspaceHistory lhs;
+    lhs.addHistory(shared);
+    lhs.addHistory(first);
+    lhs.addHistory(third);
+    WorkspaceHistory rhs;
+    // A copy of a record is the same history as the record itself
+    rhs.addHistory(boost::make_shared<AlgorithmHistory>(*shared));
+    rhs.addHistory(second);
+
+    lhs.addHistory(rhs);
+
+    TS_ASSERT_EQUALS(lhs.size(), 4);
+    TS_ASSERT_EQUALS(lhs.getAlgorithmHistory(0)->name(), "Shared");
+    TS_ASSERT_EQUALS(lhs.getAlgorithmHistory(1)->name(), "First");
+    TS_ASSERT_EQUALS(lhs.getAlgorithmHistory(2)->name(), "Second");
+    TS_ASSERT_EQUALS(lhs.getAlgorithmHistory(3)->name(), "Third");
+  }
+
   void test_Empty_History_Throws_When_Retrieving_Attempting_To_Algorithms() {
     WorkspaceHistory emptyHistory;
     TS_ASSERT_THROWS(emptyHistory.lastAlgorithm(), const std::out_of_range &);
@@ -83,6 +83,11 @@ public:
     return "Diffraction\\Focussing";
   }
 
+protected:
+  Parallel::ExecutionMode getParallelExecutionMode(
+      const std::map<std::string, Parallel::StorageMode> &storageModes)
+      const override;
+
 private:
   // Overridden Algorithm methods
   void init() override;
@@ -99,6 +104,10 @@ private:
   /// The result is stored in group2params
   void determineRebinParameters();
   int validateSpectrumInGroup(size_t wi);
+  /// Sum the unnormalised groups of all MPI ranks on the root rank
+  void reduceGroups(API::MatrixWorkspace &out,
+                    std::vector<MantidVec> &groupWgts,
+                    std::vector<double> &groupSizes) const;
 
   /// Shared pointer to the input workspace
   API::MatrixWorkspace_const_sptr m_matrixInputW;
@@ -130,6 +139,8 @@ private:
   std::vector<std::vector<std::size_t>> m_wsIndices;
   /// List of valid group numbers
   std::vector<Indexing::SpectrumNumber> m_validGroups;
+  /// Whether the input spectra are distributed over several MPI ranks
+  bool m_distributed = false;
 };
 
 } // namespace Algorithms
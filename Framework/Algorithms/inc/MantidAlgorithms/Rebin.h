@@ -71,6 +71,7 @@ protected:
   const std::string workspaceMethodInputProperty() const override {
     return "InputWorkspace";
   }
+  bool processGroupsInParallel() const override { return true; }
 
   // Overridden Algorithm methods
   void init() override;
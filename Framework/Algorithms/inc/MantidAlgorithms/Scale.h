@@ -52,6 +52,8 @@ private:
   void init() override;
   /// Execution code
   void exec() override;
+  /// Group members are independent
+  bool processGroupsInParallel() const override { return true; }
 };
 
 } // namespace Algorithms
@@ -95,6 +95,14 @@ private:
   void findNeighboursRectangular();
   void findNeighboursUbiqutious();
 
+  /// Each neighbours is specified as a pair with workspace index, weight.
+  using weightedNeighbour = std::pair<size_t, double>;
+
+  /// Forget the neighbours of all output workspace indices
+  void clearNeighbours();
+  /// Append the neighbours of the next output workspace index
+  void addNeighbours(const std::vector<weightedNeighbour> &neighbours);
+
   /// Sets the weighting stragegy.
   void setWeightingStrategy(const std::string &strategyName, double &cutOff);
   /// Translate the entered radius into meters.
@@ -135,11 +143,12 @@ private:
   /// Input workspace
   Mantid::API::MatrixWorkspace_sptr inWS;
 
-  /// Each neighbours is specified as a pair with workspace index, weight.
-  using weightedNeighbour = std::pair<size_t, double>;
-
-  /// Vector of list of neighbours (with weight) for each workspace index.
-  std::vector<std::vector<weightedNeighbour>> m_neighbours;
+  /// Neighbours (with weight) of all output workspace indices, stored one
+  /// output workspace index after the other.
+  std::vector<weightedNeighbour> m_neighbours;
+  /// Position in m_neighbours of the first neighbour of each output workspace
+  /// index, followed by the total number of neighbours.
+  std::vector<size_t> m_neighbourOffsets;
 
   /// Progress reporter
   std::unique_ptr<Mantid::API::Progress> m_progress = nullptr;
@@ -7,6 +7,7 @@
 #include "MantidAlgorithms/DiffractionFocussing2.h"
 #include "MantidAPI/Axis.h"
 #include "MantidAPI/FileProperty.h"
+#include "MantidAPI/HistoWorkspace.h"
 #include "MantidAPI/ISpectrum.h"
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/RawCountValidator.h"
@@ -20,8 +21,12 @@
 #include "MantidIndexing/Group.h"
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/VectorHelper.h"
+#include "MantidParallel/Collectives.h"
+#include "MantidParallel/Communicator.h"
 
+#include <algorithm>
 #include <cfloat>
+#include <functional>
 #include <iterator>
 #include <numeric>
 
@@ -38,6 +43,53 @@ namespace Algorithms {
 // Register the class into the algorithm factory
 DECLARE_ALGORITHM(DiffractionFocussing2)
 
+namespace {
+/// Combine two vectors element by element with op
+template <class BinaryOp> auto elementwise(BinaryOp op) {
+  return [op](const std::vector<double> &lhs, const std::vector<double> &rhs) {
+    std::vector<double> result(lhs.size());
+    std::transform(lhs.cbegin(), lhs.cend(), rhs.cbegin(), result.begin(), op);
+    return result;
+  };
+}
+
+/**
+ * Turn the summed counts of a group into the focussed spectrum: take the
+ * square root of the summed squared errors, then normalise the data by the
+ * weights of the bins and scale by the number of spectra in the group.
+ */
+void normaliseGroup(const HistogramData::BinEdges &Xout, MantidVec &Yout,
+                    MantidVec &Eout, const MantidVec &groupWgt,
+                    const double groupSize) {
+  // Calculate the bin widths
+  std::vector<double> widths(Xout.size());
+  std::adjacent_difference(Xout.begin(), Xout.end(), widths.begin());
+
+  // Take the square root of the errors
+  std::transform(Eout.begin(), Eout.end(), Eout.begin(),
+                 static_cast<double (*)(double)>(sqrt));
+
+  // Multiply the data and errors by the bin widths because the rebin
+  // function, when used
+  // in the fashion above for the weights, doesn't put it back in
+  std::transform(Yout.begin(), Yout.end(), widths.begin() + 1, Yout.begin(),
+                 std::multiplies<double>());
+  std::transform(Eout.begin(), Eout.end(), widths.begin() + 1, Eout.begin(),
+                 std::multiplies<double>());
+
+  // Now need to normalise the data (and errors) by the weights
+  std::transform(Yout.begin(), Yout.end(), groupWgt.begin(), Yout.begin(),
+                 std::divides<double>());
+  std::transform(Eout.begin(), Eout.end(), groupWgt.begin(), Eout.begin(),
+                 std::divides<double>());
+  // Now multiply by the number of spectra in the group
+  std::for_each(Yout.begin(), Yout.end(),
+                [groupSize](double &val) { val *= groupSize; });
+  std::for_each(Eout.begin(), Eout.end(),
+                [groupSize](double &val) { val *= groupSize; });
+}
+} // namespace
+
 /** Initialisation method. Declares properties to be used in algorithm.
  *
  */
@@ -107,6 +159,11 @@ void DiffractionFocussing2::exec() {
   m_matrixInputW = getProperty("InputWorkspace");
   nPoints = static_cast<int>(m_matrixInputW->blocksize());
   nHist = static_cast<int>(m_matrixInputW->getNumberHistograms());
+  m_distributed =
+      m_matrixInputW->storageMode() == Parallel::StorageMode::Distributed;
+  if (m_distributed && !groupingFileName.empty())
+    throw std::invalid_argument("A GroupingWorkspace must be used to focus a "
+                                "workspace distributed over MPI ranks.");
 
   // Validate UnitID (spacing)
   Axis *axis = m_matrixInputW->getAxis(0);
@@ -149,6 +206,10 @@ void DiffractionFocussing2::exec() {
   m_eventW = boost::dynamic_pointer_cast<const EventWorkspace>(m_matrixInputW);
   if (m_eventW != nullptr) {
     if (getProperty("PreserveEvents")) {
+      if (m_distributed)
+        throw std::runtime_error(
+            "Focussing events distributed over MPI ranks is not supported. Set "
+            "PreserveEvents to false.");
       // Input workspace is an event workspace. Use the other exec method
       this->execEvent();
       this->cleanup();
@@ -160,6 +221,18 @@ void DiffractionFocussing2::exec() {
     }
   }
 
+  if (m_distributed) {
+    // A rank may hold no spectra, so check the values of all ranks to make
+    // every rank throw or none
+    int64_t globalGroups = 0;
+    int globalPoints = 0;
+    Parallel::all_reduce(communicator(), nGroups, globalGroups,
+                         [](int64_t a, int64_t b) { return std::max(a, b); });
+    Parallel::all_reduce(communicator(), nPoints, globalPoints,
+                         [](int a, int b) { return std::max(a, b); });
+    nGroups = globalGroups;
+    nPoints = globalPoints;
+  }
   // Check valida detectors are found in the .Cal file
   if (nGroups <= 0) {
     throw std::runtime_error("No selected Detectors found in .cal file for "
@@ -170,13 +243,32 @@ void DiffractionFocussing2::exec() {
   if (nPoints <= 0) {
     throw std::runtime_error("No points found in the data range.");
   }
-  API::MatrixWorkspace_sptr out = API::WorkspaceFactory::Instance().create(
-      m_matrixInputW, m_validGroups.size(), nPoints + 1, nPoints);
+  API::MatrixWorkspace_sptr out;
+  if (m_distributed) {
+    // The groups are summed on rank 0. On all other ranks this is a temporary
+    // workspace holding the local contributions.
+    Indexing::IndexInfo indexInfo(m_validGroups,
+                                  communicator().rank() == 0
+                                      ? Parallel::StorageMode::MasterOnly
+                                      : Parallel::StorageMode::Cloned,
+                                  communicator());
+    indexInfo.setSpectrumDefinitions(
+        std::vector<SpectrumDefinition>(m_validGroups.size()));
+    out = create<HistoWorkspace>(*m_matrixInputW, indexInfo,
+                                 BinEdges(nPoints + 1));
+  } else {
+    out = API::WorkspaceFactory::Instance().create(
+        m_matrixInputW, m_validGroups.size(), nPoints + 1, nPoints);
+  }
   // Caching containers that are either only read from or unused. Initialize
   // them once.
   // Helgrind will show a race-condition but the data is completely unused so it
   // is irrelevant
   MantidVec weights_default(1, 1.0), emptyVec(1, 0.0), EOutDummy(nPoints);
+  // The weights and sizes of the groups, kept until the groups of all ranks
+  // have been summed when the input is distributed
+  std::vector<MantidVec> groupWgts(m_distributed ? m_validGroups.size() : 0);
+  std::vector<double> groupSizes(groupWgts.size(), 0.0);
 
   Progress prog(this, 0.2, 1.0, static_cast<int>(totalHistProcess) + nGroups);
 
@@ -196,7 +288,8 @@ void DiffractionFocussing2::exec() {
 
     // This is the output spectrum
     auto &outSpec = out->getSpectrum(outWorkspaceIndex);
-    outSpec.setSpectrumNo(group);
+    if (!m_distributed)
+      outSpec.setSpectrumNo(group);
 
     // Get the references to Y and E output and rebin
     // TODO can only be changed once rebin implemented in HistogramData
@@ -290,41 +383,34 @@ void DiffractionFocussing2::exec() {
       prog.report();
     } // end of loop for input spectra
 
-    // Calculate the bin widths
-    std::vector<double> widths(Xout.size());
-    std::adjacent_difference(Xout.begin(), Xout.end(), widths.begin());
-
-    // Take the square root of the errors
-    std::transform(Eout.begin(), Eout.end(), Eout.begin(),
-                   static_cast<double (*)(double)>(sqrt));
-
-    // Multiply the data and errors by the bin widths because the rebin
-    // function, when used
-    // in the fashion above for the weights, doesn't put it back in
-    std::transform(Yout.begin(), Yout.end(), widths.begin() + 1, Yout.begin(),
-                   std::multiplies<double>());
-    std::transform(Eout.begin(), Eout.end(), widths.begin() + 1, Eout.begin(),
-                   std::multiplies<double>());
-
-    // Now need to normalise the data (and errors) by the weights
-    std::transform(Yout.begin(), Yout.end(), groupWgt.begin(), Yout.begin(),
-                   std::divides<double>());
-    std::transform(Eout.begin(), Eout.end(), groupWgt.begin(), Eout.begin(),
-                   std::divides<double>());
-    // Now multiply by the number of spectra in the group
-    std::for_each(Yout.begin(), Yout.end(), [groupSize](double &val) {
-      val *= static_cast<double>(groupSize);
-    });
-    std::for_each(Eout.begin(), Eout.end(), [groupSize](double &val) {
-      val *= static_cast<double>(groupSize);
-    });
+    if (m_distributed) {
+      // Other ranks hold more of this group, normalise after summing them
+      groupWgts[outWorkspaceIndex] = std::move(groupWgt);
+      groupSizes[outWorkspaceIndex] = static_cast<double>(groupSize);
+    } else {
+      normaliseGroup(Xout, Yout, Eout, groupWgt,
+                     static_cast<double>(groupSize));
+    }
 
     prog.report();
     PARALLEL_END_INTERUPT_REGION
   } // end of loop for groups
   PARALLEL_CHECK_INTERUPT_REGION
 
-  setProperty("OutputWorkspace", out);
+  if (m_distributed) {
+    reduceGroups(*out, groupWgts, groupSizes);
+    if (communicator().rank() == 0) {
+      for (size_t i = 0; i < m_validGroups.size(); ++i) {
+        const int group = static_cast<int>(m_validGroups[i]);
+        auto &outSpec = out->getSpectrum(i);
+        normaliseGroup(group2xvector.at(group), outSpec.dataY(),
+                       outSpec.dataE(), groupWgts[i], groupSizes[i]);
+      }
+      setProperty("OutputWorkspace", out);
+    }
+  } else {
+    setProperty("OutputWorkspace", out);
+  }
 
   this->cleanup();
 }
@@ -588,6 +674,34 @@ void DiffractionFocussing2::determineRebinParameters() {
       (gpit->second).second = temp;
   }
 
+  if (m_distributed) {
+    // Every rank must use the same bin edges for a group, so combine the
+    // ranges found on all ranks. The grouping is the same on all ranks.
+    const int maxGroup =
+        udet2group.empty()
+            ? 0
+            : *std::max_element(udet2group.cbegin(), udet2group.cend());
+    std::vector<double> mins(std::max(maxGroup, 0) + 1, BIGGEST);
+    std::vector<double> maxs(mins.size(), -1. * BIGGEST);
+    for (const auto &range : group2minmax) {
+      mins[range.first] = range.second.first;
+      maxs[range.first] = range.second.second;
+    }
+    std::vector<double> globalMins, globalMaxs;
+    Parallel::all_reduce(
+        communicator(), mins, globalMins,
+        elementwise([](double a, double b) { return std::min(a, b); }));
+    Parallel::all_reduce(
+        communicator(), maxs, globalMaxs,
+        elementwise([](double a, double b) { return std::max(a, b); }));
+    group2minmax.clear();
+    for (int group = 1; group <= maxGroup; ++group) {
+      if (globalMaxs[group] != -1. * BIGGEST)
+        group2minmax.emplace(group, std::make_pair(globalMins[group],
+                                                   globalMaxs[group]));
+    }
+  }
+
   nGroups = group2minmax.size(); // Number of unique groups
 
   double Xmin, Xmax, step;
@@ -656,6 +770,12 @@ size_t DiffractionFocussing2::setupGroupToWSIndices() {
     wsIndices[group].push_back(wi);
   }
 
+  // A valid group may have no spectra here if they are on other MPI ranks
+  if (!group2xvector.empty())
+    wsIndices.resize(std::max(
+        wsIndices.size(),
+        static_cast<size_t>(group2xvector.rbegin()->first) + 1));
+
   // initialize a vector of the valid group numbers
   size_t totalHistProcess = 0;
   for (const auto &item : group2xvector) {
@@ -670,5 +790,82 @@ size_t DiffractionFocussing2::setupGroupToWSIndices() {
   return totalHistProcess;
 }
 
+/**
+ * Sum the focussed groups of all MPI ranks on rank 0. Each rank holds the
+ * counts and squared errors of its own spectra, not yet normalised, together
+ * with the weights and number of spectra of each group. All of these add up.
+ * @param out :: The focussed workspace. On rank 0 it receives the sums.
+ * @param groupWgts :: The weights of the bins of each group
+ * @param groupSizes :: The number of spectra in each group
+ */
+void DiffractionFocussing2::reduceGroups(
+    API::MatrixWorkspace &out, std::vector<MantidVec> &groupWgts,
+    std::vector<double> &groupSizes) const {
+  const auto &comm = communicator();
+  const size_t numberOfGroups = m_validGroups.size();
+  const auto binCount = static_cast<size_t>(nPoints);
+  // Counts, squared errors and weights of all bins, then the group size
+  const size_t stride = 3 * binCount + 1;
+  if (comm.rank() != 0) {
+    std::vector<double> buffer(numberOfGroups * stride);
+    std::vector<int> detectorCounts(numberOfGroups);
+    std::vector<detid_t> detectorIDs;
+    for (size_t i = 0; i < numberOfGroups; ++i) {
+      auto values = buffer.begin() + i * stride;
+      const auto &outSpec = out.getSpectrum(i);
+      values = std::copy(outSpec.dataY().cbegin(), outSpec.dataY().cend(),
+                         values);
+      values = std::copy(outSpec.dataE().cbegin(), outSpec.dataE().cend(),
+                         values);
+      values = std::copy(groupWgts[i].cbegin(), groupWgts[i].cend(), values);
+      *values = groupSizes[i];
+      const auto &ids = outSpec.getDetectorIDs();
+      detectorCounts[i] = static_cast<int>(ids.size());
+      detectorIDs.insert(detectorIDs.end(), ids.cbegin(), ids.cend());
+    }
+    Parallel::gather(comm, buffer, 0);
+    Parallel::gather(comm, detectorCounts, 0);
+    Parallel::gather(comm, detectorIDs, 0);
+    return;
+  }
+
+  // Rank 0 already holds its own contributions in out, so it sends nothing
+  std::vector<std::vector<double>> buffers;
+  std::vector<std::vector<int>> detectorCounts;
+  std::vector<std::vector<detid_t>> detectorIDs;
+  Parallel::gather(comm, std::vector<double>(), buffers, 0);
+  Parallel::gather(comm, std::vector<int>(), detectorCounts, 0);
+  Parallel::gather(comm, std::vector<detid_t>(), detectorIDs, 0);
+  const auto add = [](MantidVec &sum,
+                      std::vector<double>::const_iterator values) {
+    std::transform(sum.begin(), sum.end(), values, sum.begin(),
+                   std::plus<double>());
+  };
+  for (int rank = 1; rank < comm.size(); ++rank) {
+    auto detectorID = detectorIDs[rank].cbegin();
+    for (size_t i = 0; i < numberOfGroups; ++i) {
+      auto values = buffers[rank].cbegin() + i * stride;
+      auto &outSpec = out.getSpectrum(i);
+      add(outSpec.dataY(), values);
+      add(outSpec.dataE(), values + binCount);
+      add(groupWgts[i], values + 2 * binCount);
+      groupSizes[i] += *(values + 3 * binCount);
+      const auto lastDetectorID = detectorID + detectorCounts[rank][i];
+      outSpec.addDetectorIDs(std::vector<detid_t>(detectorID, lastDetectorID));
+      detectorID = lastDetectorID;
+    }
+  }
+}
+
+Parallel::ExecutionMode DiffractionFocussing2::getParallelExecutionMode(
+    const std::map<std::string, Parallel::StorageMode> &storageModes) const {
+  using namespace Parallel;
+  const auto &groupingMode = storageModes.find("GroupingWorkspace");
+  if (groupingMode != storageModes.end())
+    if (groupingMode->second != StorageMode::Cloned)
+      return ExecutionMode::Invalid;
+  return getCorrespondingExecutionMode(storageModes.at("InputWorkspace"));
+}
+
 } // namespace Algorithms
 } // namespace Mantid
\ No newline at end of file
@@ -27,6 +27,8 @@
 
 #include "MantidTypes/SpectrumDefinition.h"
 
+#include <numeric>
+
 using Mantid::HistogramData::HistogramX;
 
 namespace Mantid {
@@ -308,35 +310,85 @@ void MergeRuns::execEvent() {
   auto outWS =
       create<EventWorkspace>(*inputWS, m_outputSize, inputWS->binEdges(0));
   const auto inputSize = inputWS->getNumberHistograms();
-  for (size_t i = 0; i < inputSize; ++i)
-    outWS->getSpectrum(i) = inputWS->getSpectrum(i);
-
-  int64_t n = m_inEventWS.size() - 1;
-  m_progress = std::make_unique<Progress>(this, 0.0, 1.0, n);
 
-  // Note that we start at 1, since we already have the 0th workspace
+  // Invert the addition tables: list, for every output spectrum, the
+  // (workspace number, workspace index) pairs of the input spectra that are
+  // added to it, in the order of the input workspaces. Spectra that are not
+  // in the first workspace get new indices at the end of the output, in the
+  // order they are found.
+  std::vector<size_t> offsets(m_outputSize + 1, 0);
   auto current = inputSize;
-  for (size_t workspaceNum = 1; workspaceNum < m_inEventWS.size();
-       workspaceNum++) {
-    const auto &addee = *m_inEventWS[workspaceNum];
-    const auto &table = m_tables[workspaceNum - 1];
-
-    // Add all the event lists together as the table says to do
+  for (auto &table : m_tables) {
     for (auto &WI : table) {
-      int64_t inWI = WI.first;
-      int64_t outWI = WI.second;
-      if (outWI >= 0) {
-        outWS->getSpectrum(outWI) += addee.getSpectrum(inWI);
-      } else {
-        outWS->getSpectrum(current) = addee.getSpectrum(inWI);
-        ++current;
+      if (WI.second < 0)
+        WI.second = static_cast<int>(current++);
+      ++offsets[WI.second + 1];
+    }
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  std::vector<std::pair<int, int>> contributions(offsets.back());
+  {
+    std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+    for (size_t workspaceNum = 1; workspaceNum < m_inEventWS.size();
+         workspaceNum++) {
+      for (const auto &WI : m_tables[workspaceNum - 1]) {
+        contributions[next[WI.second]++] =
+            std::make_pair(static_cast<int>(workspaceNum), WI.first);
+      }
+    }
+  }
+  m_tables.clear();
+
+  m_progress = std::make_unique<Progress>(this, 0.0, 1.0, m_outputSize);
+  const auto inputSpectrum =
+      [this](const std::pair<int, int> &input) -> const EventList & {
+    const EventWorkspace &ws = *m_inEventWS[input.first];
+    return ws.getSpectrum(input.second);
+  };
+
+  // Every output spectrum is built independently, so the spectra can be
+  // merged in parallel.
+  PARALLEL_FOR_IF(Kernel::threadSafe(*outWS))
+  for (int64_t outWI = 0; outWI < static_cast<int64_t>(m_outputSize);
+       ++outWI) {
+    PARALLEL_START_INTERUPT_REGION
+    auto begin = contributions.cbegin() + offsets[outWI];
+    const auto end = contributions.cbegin() + offsets[outWI + 1];
+    auto &outSpec = outWS->getSpectrum(outWI);
+    if (static_cast<size_t>(outWI) < inputSize) {
+      outSpec = inputSpectrum(std::make_pair(0, static_cast<int>(outWI)));
+    } else if (begin != end) {
+      // A spectrum that is not in the first workspace
+      outSpec = inputSpectrum(*begin);
+      ++begin;
+    }
+
+    // Grow the list once to its final size rather than once per input
+    if (outSpec.getEventType() == API::TOF) {
+      size_t numEvents = outSpec.getNumberEvents();
+      bool allTof = true;
+      for (auto it = begin; it != end; ++it) {
+        const auto &addee = inputSpectrum(*it);
+        numEvents += addee.getNumberEvents();
+        allTof = allTof && addee.getEventType() == API::TOF;
       }
+      if (allTof)
+        outSpec.reserve(numEvents);
     }
 
-    // Now we add up the runs
-    outWS->mutableRun() += addee.run();
+    for (auto it = begin; it != end; ++it) {
+      outSpec += inputSpectrum(*it);
+    }
 
     m_progress->report();
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  // Now we add up the runs
+  for (size_t workspaceNum = 1; workspaceNum < m_inEventWS.size();
+       workspaceNum++) {
+    outWS->mutableRun() += m_inEventWS[workspaceNum]->run();
   }
 
   // Set the final workspace to the output property
@@ -48,7 +48,7 @@ SmoothNeighbours::SmoothNeighbours()
     : API::Algorithm(), AdjX(0), AdjY(0), Edge(0), Radius(0.), nNeighbours(0),
       WeightedSum(new NullWeighting), PreserveEvents(false),
       expandSumAllPixels(false), outWI(0), inWS(), m_neighbours(),
-      m_progress(nullptr) {}
+      m_neighbourOffsets(1, 0), m_progress(nullptr) {}
 
 /** Initialisation method.
  *
@@ -240,10 +240,10 @@ void SmoothNeighbours::findNeighboursRectangular() {
     setWeightingStrategy("Flat", Radius);
     nNeighbours = AdjX * AdjY - 1;
     findNeighboursUbiqutious();
+    return;
   }
 
-  // Resize the vector we are setting
-  m_neighbours.resize(inWS->getNumberHistograms());
+  clearNeighbours();
   int StartX = -AdjX;
   int StartY = -AdjY;
   int EndX = AdjX;
@@ -258,7 +258,6 @@ void SmoothNeighbours::findNeighboursRectangular() {
     EndY = SumY - 1;
   }
 
-  outWI = 0;
   // Build a map to sort by the detectorID
   std::vector<std::pair<int, int>> v1;
   for (int i = 0; i < static_cast<int>(detList.size()); i++)
@@ -311,8 +310,7 @@ void SmoothNeighbours::findNeighboursRectangular() {
               neighbour.second /= totalWeight;
 
           // Save the list of neighbours for this output workspace index.
-          m_neighbours[outWI] = neighbours;
-          outWI++;
+          addNeighbours(neighbours);
 
           m_progress->report("Finding Neighbours");
         }
@@ -323,7 +321,10 @@ void SmoothNeighbours::findNeighboursRectangular() {
 }
 
 //--------------------------------------------------------------------------------------------
-/** Use NearestNeighbours to find the neighbours for any instrument
+/** Use NearestNeighbours to find the neighbours for any instrument. The
+ * neighbours of each spectrum are found in parallel unless neighbours are
+ * summed, in which case a spectrum can only be used once and the search has
+ * to go in order of workspace index.
  */
 void SmoothNeighbours::findNeighboursUbiqutious() {
   g_log.debug(
@@ -332,38 +333,38 @@ void SmoothNeighbours::findNeighboursUbiqutious() {
   m_progress->resetNumSteps(inWS->getNumberHistograms(), 0.2, 0.5);
   this->progress(0.2, "Building Neighbour Map");
 
-  Instrument_const_sptr inst = inWS->getInstrument();
-  const spec2index_map spec2index = inWS->getSpectrumToWorkspaceIndexMap();
-
-  // Resize the vector we are setting
-  m_neighbours.resize(inWS->getNumberHistograms());
+  const MatrixWorkspace &ws = *inWS;
+  const size_t numberOfSpectra = ws.getNumberHistograms();
+  const spec2index_map spec2index = ws.getSpectrumToWorkspaceIndexMap();
 
   bool ignoreMaskedDetectors = getProperty("IgnoreMaskedDetectors");
-  WorkspaceNearestNeighbourInfo neighbourInfo(*inWS, ignoreMaskedDetectors,
+  WorkspaceNearestNeighbourInfo neighbourInfo(ws, ignoreMaskedDetectors,
                                               nNeighbours);
 
   // Cull by radius
   RadiusFilter radiusFilter(Radius);
 
+  const int sum = getProperty("SumNumberOfNeighbours");
+  // Neighbours of each input workspace index, and whether the index gives an
+  // output spectrum at all
+  std::vector<std::vector<weightedNeighbour>> indexNeighbours(numberOfSpectra);
+  std::vector<char> hasOutput(numberOfSpectra, false);
+  std::vector<char> used(numberOfSpectra, false);
+  const auto &detectorInfo = ws.detectorInfo();
+
   // Go through every input workspace pixel
-  outWI = 0;
-  int sum = getProperty("SumNumberOfNeighbours");
-  boost::shared_ptr<const Geometry::IComponent> parent, neighbParent,
-      grandparent, neighbGParent;
-  auto used = new bool[inWS->getNumberHistograms()];
-  if (sum > 1) {
-    for (size_t wi = 0; wi < inWS->getNumberHistograms(); wi++)
-      used[wi] = false;
-  }
-  const auto &detectorInfo = inWS->detectorInfo();
-  for (size_t wi = 0; wi < inWS->getNumberHistograms(); wi++) {
+  PARALLEL_FOR_IF(sum == 1 && Kernel::threadSafe(ws))
+  for (int i = 0; i < static_cast<int>(numberOfSpectra); ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    const auto wi = static_cast<size_t>(i);
     if (sum > 1)
       if (used[wi])
         continue;
+    boost::shared_ptr<const Geometry::IComponent> parent, grandparent;
     // We want to skip monitors
     try {
       // Get the list of detectors in this pixel
-      const auto &dets = inWS->getSpectrum(wi).getDetectorIDs();
+      const auto &dets = ws.getSpectrum(wi).getDetectorIDs();
       const auto index = detectorInfo.indexOf(*dets.begin());
       if (detectorInfo.isMonitor(index))
         continue; // skip monitor
@@ -371,7 +372,7 @@ void SmoothNeighbours::findNeighboursUbiqutious() {
         // Calibration masks many detectors, but there should be 0s after
         // smoothing
         if (sum == 1)
-          outWI++;
+          hasOutput[wi] = true;
         continue; // skip masked detectors
       }
       if (sum > 1) {
@@ -384,7 +385,7 @@ void SmoothNeighbours::findNeighboursUbiqutious() {
       continue; // skip missing detector
     }
 
-    specnum_t inSpec = inWS->getSpectrum(wi).getSpectrumNo();
+    specnum_t inSpec = ws.getSpectrum(wi).getSpectrumNo();
 
     // Step one - Get the number of specified neighbours
     SpectraDistanceMap insideGrid = neighbourInfo.getNeighboursExact(inSpec);
@@ -400,7 +401,7 @@ void SmoothNeighbours::findNeighboursUbiqutious() {
     // Neighbours and weights list
     double totalWeight = 0;
     int noNeigh = 0;
-    std::vector<weightedNeighbour> neighbours;
+    std::vector<weightedNeighbour> &neighbours = indexNeighbours[wi];
 
     // Convert from spectrum numbers to workspace indices
     for (auto &specDistance : neighbSpectra) {
@@ -417,10 +418,10 @@ void SmoothNeighbours::findNeighboursUbiqutious() {
           if (sum > 1) {
             // Get the list of detectors in this pixel
             const std::set<detid_t> &dets =
-                inWS->getSpectrum(neighWI).getDetectorIDs();
+                ws.getSpectrum(neighWI).getDetectorIDs();
             const auto &det = detectorInfo.detector(*dets.begin());
-            neighbParent = det.getParent();
-            neighbGParent = neighbParent->getParent();
+            const auto neighbParent = det.getParent();
+            const auto neighbGParent = neighbParent->getParent();
             if (noNeigh >= sum ||
                 neighbParent->getName() != parent->getName() ||
                 neighbGParent->getName() != grandparent->getName() ||
@@ -440,14 +441,38 @@ void SmoothNeighbours::findNeighboursUbiqutious() {
       for (auto &neighbour : neighbours)
         neighbour.second /= totalWeight;
 
-    // Save the list of neighbours for this output workspace index.
-    m_neighbours[outWI] = neighbours;
-    outWI++;
+    hasOutput[wi] = true;
 
     m_progress->report("Finding Neighbours");
+    PARALLEL_END_INTERUPT_REGION
   } // each workspace index
+  PARALLEL_CHECK_INTERUPT_REGION
 
-  delete[] used;
+  // Save the lists of neighbours in order of output workspace index.
+  clearNeighbours();
+  for (size_t wi = 0; wi < numberOfSpectra; ++wi) {
+    if (hasOutput[wi])
+      addNeighbours(indexNeighbours[wi]);
+  }
+}
+
+/// Forget the neighbours of all output workspace indices
+void SmoothNeighbours::clearNeighbours() {
+  m_neighbours.clear();
+  m_neighbourOffsets.assign(1, 0);
+  outWI = 0;
+}
+
+/**
+ * Append the neighbours of the next output workspace index
+ * @param neighbours :: The neighbours (with weight) of the output workspace
+ * index
+ */
+void SmoothNeighbours::addNeighbours(
+    const std::vector<weightedNeighbour> &neighbours) {
+  m_neighbours.insert(m_neighbours.end(), neighbours.begin(), neighbours.end());
+  m_neighbourOffsets.emplace_back(m_neighbours.size());
+  outWI++;
 }
 
 /**
@@ -614,9 +639,11 @@ void SmoothNeighbours::execWorkspace2D() {
     auto &outX = outSpec.mutableX();
 
     // Which are the neighbours?
-    std::vector<weightedNeighbour> &neighbours = m_neighbours[outWIi];
-    std::vector<weightedNeighbour>::iterator it;
-    for (it = neighbours.begin(); it != neighbours.end(); ++it) {
+    const auto firstNeighbour =
+        m_neighbours.cbegin() + m_neighbourOffsets[outWIi];
+    const auto lastNeighbour =
+        m_neighbours.cbegin() + m_neighbourOffsets[outWIi + 1];
+    for (auto it = firstNeighbour; it != lastNeighbour; ++it) {
       size_t inWI = it->first;
       double weight = it->second;
       double weightSquared = weight * weight;
@@ -676,8 +703,9 @@ void SmoothNeighbours::setupNewInstrument(MatrixWorkspace &outws) const {
     outSpec.clearDetectorIDs();
 
     // Which are the neighbours?
-    for (const auto &neighbor : m_neighbours[outWIi]) {
-      const auto &inSpec = inWS->getSpectrum(neighbor.first);
+    for (size_t n = m_neighbourOffsets[outWIi];
+         n < m_neighbourOffsets[outWIi + 1]; ++n) {
+      const auto &inSpec = inWS->getSpectrum(m_neighbours[n].first);
       outSpec.addDetectorIDs(inSpec.getDetectorIDs());
     }
   }
@@ -719,8 +747,9 @@ void SmoothNeighbours::spreadPixels(MatrixWorkspace_sptr outws) {
   for (int outWIi = 0; outWIi < int(numberOfSpectra2); outWIi++) {
 
     // Which are the neighbours?
-    for (const auto &neighbor : m_neighbours[outWIi]) {
-      outws2->setHistogram(neighbor.first, outws->histogram(outWIi));
+    for (size_t n = m_neighbourOffsets[outWIi];
+         n < m_neighbourOffsets[outWIi + 1]; ++n) {
+      outws2->setHistogram(m_neighbours[n].first, outws->histogram(outWIi));
     }
   }
   this->setProperty("OutputWorkspace", outws2);
@@ -758,9 +787,11 @@ void SmoothNeighbours::execEvent(Mantid::DataObjects::EventWorkspace_sptr &ws) {
     EventList &outEL = outWS->getSpectrum(outWIi);
 
     // Which are the neighbours?
-    std::vector<weightedNeighbour> &neighbours = m_neighbours[outWIi];
-    std::vector<weightedNeighbour>::iterator it;
-    for (it = neighbours.begin(); it != neighbours.end(); ++it) {
+    const auto firstNeighbour =
+        m_neighbours.cbegin() + m_neighbourOffsets[outWIi];
+    const auto lastNeighbour =
+        m_neighbours.cbegin() + m_neighbourOffsets[outWIi + 1];
+    for (auto it = firstNeighbour; it != lastNeighbour; ++it) {
       size_t inWI = it->first;
       // if(sum)outEL.copyInfoFrom(*ws->getSpectrum(inWI));
       double weight = it->second;
@@ -18,6 +18,8 @@
 #include "MantidKernel/PhysicalConstants.h"
 #include "MantidTypes/SpectrumDefinition.h"
 
+#include <algorithm>
+
 namespace Mantid {
 namespace Algorithms {
 
@@ -83,6 +85,7 @@ void SofQWPolygon::exec() {
     const double thetaLower = theta - halfWidth;
     const double thetaUpper = theta + halfWidth;
 
+    std::vector<size_t> qIndices;
     for (size_t j = 0; j < nenergyBins; ++j) {
       m_progress->report("Computing polygon intersections");
       // For each input polygon test where it intersects with
@@ -105,16 +108,21 @@ void SofQWPolygon::exec() {
       const MantidVec::difference_type qIndex =
           std::upper_bound(m_Qout.begin(), m_Qout.end(), lrQ) - m_Qout.begin();
       if (qIndex != 0 && qIndex < static_cast<int>(m_Qout.size())) {
-        // Add this spectra-detector pair to the mapping
-        PARALLEL_CRITICAL(SofQWPolygon_spectramap) {
-          // Could do a more complete merge of spectrum definitions here, but
-          // historically only the ID of the first detector in the spectrum is
-          // used, so I am keeping that for now.
-          detIDMapping[qIndex - 1].add(
-              spectrumInfo.spectrumDefinition(i)[0].first);
-        }
+        qIndices.emplace_back(static_cast<size_t>(qIndex - 1));
       }
     }
+    // Add this spectra-detector pair to the mapping of each Q bin it
+    // contributes to, locking once per spectrum rather than once per bin
+    std::sort(qIndices.begin(), qIndices.end());
+    qIndices.erase(std::unique(qIndices.begin(), qIndices.end()),
+                   qIndices.end());
+    PARALLEL_CRITICAL(SofQWPolygon_spectramap) {
+      // Could do a more complete merge of spectrum definitions here, but
+      // historically only the ID of the first detector in the spectrum is
+      // used, so I am keeping that for now.
+      for (const auto qIndex : qIndices)
+        detIDMapping[qIndex].add(spectrumInfo.spectrumDefinition(i)[0].first);
+    }
 
     PARALLEL_END_INTERUPT_REGION
   }
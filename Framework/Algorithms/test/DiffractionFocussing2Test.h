@@ -16,9 +16,15 @@
 #include "MantidDataHandling/LoadNexus.h"
 #include "MantidDataHandling/LoadRaw3.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/GroupingWorkspace.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidHistogramData/LinearGenerator.h"
+#include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/cow_ptr.h"
+#include "MantidTestHelpers/ComponentCreationHelper.h"
+#include "MantidTestHelpers/ParallelAlgorithmCreation.h"
+#include "MantidTestHelpers/ParallelRunner.h"
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
 #include <cxxtest/TestSuite.h>
 
@@ -31,6 +37,59 @@ using namespace Mantid::DataObjects;
 using Mantid::HistogramData::BinEdges;
 using Mantid::Types::Event::TofEvent;
 
+namespace {
+MatrixWorkspace_sptr
+focus_for_storage_mode(const Parallel::Communicator &comm,
+                       const Parallel::StorageMode storageMode) {
+  const size_t numberOfDetectors = 18;
+  auto instrument = ComponentCreationHelper::createTestInstrumentCylindrical(2);
+  auto grouping = boost::make_shared<GroupingWorkspace>(instrument);
+  for (detid_t detID = 1; detID <= static_cast<detid_t>(numberOfDetectors);
+       ++detID)
+    grouping->setValue(detID, 1 + detID % 2);
+
+  MatrixWorkspace_sptr ws = create<Workspace2D>(
+      instrument, Indexing::IndexInfo(numberOfDetectors, storageMode, comm),
+      HistogramData::Histogram(BinEdges{1.0, 2.0, 3.0, 4.0},
+                               HistogramData::Counts(3, 0.0)));
+  ws->getAxis(0)->setUnit("dSpacing");
+  for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+    const auto value = static_cast<double>(ws->getSpectrum(i).getSpectrumNo());
+    ws->mutableY(i) = value;
+    ws->mutableE(i) = std::sqrt(value);
+  }
+
+  auto alg = ParallelTestHelpers::create<DiffractionFocussing2>(comm);
+  alg->setProperty("InputWorkspace", ws);
+  alg->setProperty("GroupingWorkspace", grouping);
+  TS_ASSERT_THROWS_NOTHING(alg->execute());
+  return alg->getProperty("OutputWorkspace");
+}
+
+void run_focussing_distributed(const Parallel::Communicator &comm) {
+  using namespace Parallel;
+  auto reference = focus_for_storage_mode(comm, StorageMode::Cloned);
+  auto out = focus_for_storage_mode(comm, StorageMode::Distributed);
+  if (comm.rank() != 0) {
+    TS_ASSERT_EQUALS(out, nullptr);
+    return;
+  }
+  TS_ASSERT_EQUALS(out->storageMode(), StorageMode::MasterOnly);
+  TS_ASSERT_EQUALS(out->getNumberHistograms(), 2);
+  for (size_t i = 0; i < out->getNumberHistograms(); ++i) {
+    TS_ASSERT_EQUALS(out->getSpectrum(i).getSpectrumNo(),
+                     reference->getSpectrum(i).getSpectrumNo());
+    TS_ASSERT_EQUALS(out->getSpectrum(i).getDetectorIDs(),
+                     reference->getSpectrum(i).getDetectorIDs());
+    TS_ASSERT_EQUALS(out->x(i).rawData(), reference->x(i).rawData());
+    for (size_t bin = 0; bin < out->blocksize(); ++bin) {
+      TS_ASSERT_DELTA(out->y(i)[bin], reference->y(i)[bin], 1e-12);
+      TS_ASSERT_DELTA(out->e(i)[bin], reference->e(i)[bin], 1e-12);
+    }
+  }
+}
+} // namespace
+
 class DiffractionFocussing2Test : public CxxTest::TestSuite {
 public:
   void testName() { TS_ASSERT_EQUALS(focus.name(), "DiffractionFocussing"); }
@@ -380,6 +439,10 @@ public:
     TS_ASSERT_EQUALS(outWS->getNumberHistograms(), 6);
     AnalysisDataService::Instance().remove("SNAP_focus");
   }
+
+  void test_parallel_distributed() {
+    ParallelTestHelpers::runParallel(run_focussing_distributed);
+  }
 };
 
 #endif /*DIFFRACTIONFOCUSSING2TEST_H_*/
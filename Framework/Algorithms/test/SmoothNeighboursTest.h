@@ -296,6 +296,39 @@ public:
     doTestWithNumberOfNeighbours("Flat");
   }
 
+  void testMaskedDetectorKeepsAnEmptyOutputSpectrum() {
+    MatrixWorkspace_sptr inWS =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(100, 10);
+    const size_t maskedIndex = 42;
+    inWS->mutableSpectrumInfo().setMasked(maskedIndex, true);
+
+    SmoothNeighbours alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize());
+    alg.setProperty("InputWorkspace", inWS);
+    alg.setProperty("OutputWorkspace", "testMW");
+    alg.setProperty("PreserveEvents", false);
+    alg.setProperty("NumberOfNeighbours", 8);
+    alg.setProperty("IgnoreMaskedDetectors", true);
+    alg.setProperty("Radius", 1.2);
+    alg.setProperty("RadiusUnits", "NumberOfPixels");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    MatrixWorkspace_sptr outWS =
+        AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>("testMW");
+    TS_ASSERT_EQUALS(inWS->getNumberHistograms(), outWS->getNumberHistograms());
+    TS_ASSERT(outWS->getSpectrum(maskedIndex).getDetectorIDs().empty());
+    for (const auto y : outWS->y(maskedIndex))
+      TS_ASSERT_EQUALS(y, 0.);
+    // The spectra on either side are still smoothed
+    TS_ASSERT_DELTA(outWS->y(maskedIndex - 1)[0], inWS->y(maskedIndex - 1)[0],
+                    1e-5);
+    TS_ASSERT_DELTA(outWS->y(maskedIndex + 1)[0], inWS->y(maskedIndex + 1)[0],
+                    1e-5);
+
+    AnalysisDataService::Instance().remove("testMW");
+  }
+
   void testWithNumberOfNeighboursAndLinearWeighting() {
     doTestWithNumberOfNeighbours("Linear");
   }
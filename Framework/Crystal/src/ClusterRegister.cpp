@@ -7,18 +7,11 @@
 #include "MantidCrystal/ClusterRegister.h"
 #include "MantidCrystal/Cluster.h"
 #include "MantidCrystal/CompositeCluster.h"
-#include <boost/functional/hash.hpp>
 #include <boost/make_shared.hpp>
+#include <algorithm>
 #include <list>
-#include <unordered_set>
-
-namespace {
-template <typename T> std::pair<T, T> ordered_pair(const T &a, const T &b) {
-  T min = std::min(a, b);
-  T max = std::max(a, b);
-  return std::pair<T, T>(min, max);
-}
-} // namespace
+#include <map>
+#include <unordered_map>
 
 namespace Mantid {
 namespace Crystal {
@@ -31,72 +24,43 @@ public:
   /// Clusters that do not need merging
   ClusterRegister::MapCluster m_unique;
 
-  /// Type for identifying label groups
-  using GroupType = std::list<std::unordered_set<size_t>>;
-
-  /// Groups of labels to maintain
-  GroupType m_groups;
+  /// Parent of each merged label. Labels are merged with a union-find so that
+  /// every merge is close to constant time, however many groups exist.
+  std::unordered_map<size_t, size_t> m_parents;
 
-  /// Type for identifying labels already seen
-  using LabelHash = std::unordered_set<size_t>;
-
-  /// Hash of labels merged
-  LabelHash m_labelHash;
-
-  /// Label hasher
-  boost::hash<std::pair<int, int>> m_labelHasher;
+  /**
+   * Find the representative label of the group containing a label.
+   * @param label : Label to look up
+   * @return : Representative label of the group
+   */
+  size_t find(size_t label) {
+    auto it = m_parents.find(label);
+    if (it == m_parents.end()) {
+      m_parents.emplace(label, label);
+      return label;
+    }
+    while (it->second != label) {
+      // Path halving: point each visited label at its grandparent
+      auto parent = m_parents.find(it->second);
+      it->second = parent->second;
+      label = parent->second;
+      it = m_parents.find(label);
+    }
+    return label;
+  }
 
   /**
-   * Inserts a pair of disjoint elements. Determines whether they can be used to
-   * reorder existing sets of lables.
+   * Inserts a pair of disjoint elements, joining the groups of their labels.
    * @param a : One part of pair
    * @param b : Other part of pair
-   * @return : true if a new cluster was required for the insertion.
    */
-  bool insert(const DisjointElement &a, const DisjointElement &b) {
-    const size_t &aLabel = a.getRoot();
-    const size_t &bLabel = b.getRoot();
-    bool newItem = true;
-
-    GroupType containingAny;
-    GroupType containingNone;
-    // ------------- Find equivalent sets
-    for (auto &cluster : m_groups) {
-      if (cluster.find(aLabel) != cluster.end()) {
-        containingAny.push_back(cluster);
-      } else if (cluster.find(bLabel) != cluster.end()) {
-        containingAny.push_back(cluster);
-      } else {
-        containingNone.push_back(cluster); // Current iterated set contains
-                                           // NEITHER of these labels. It can
-                                           // therfore be ignored.
-      }
+  void insert(const DisjointElement &a, const DisjointElement &b) {
+    const size_t aRoot = find(a.getRoot());
+    const size_t bRoot = find(b.getRoot());
+    if (aRoot != bRoot) {
+      // The smallest label represents the group
+      m_parents[std::max(aRoot, bRoot)] = std::min(aRoot, bRoot);
     }
-    // ------------ Process equivalent sets
-    if (containingAny.empty()) {
-      // Neither label is yet known to any set. We must add a new set for these
-      GroupType::value_type newSet;
-      newSet.insert(aLabel);
-      newSet.insert(bLabel);
-      m_groups.push_back(newSet);
-    } else {
-      // At least one set already contains at least one label. We merge all such
-      // sets into a master set.
-
-      // implement copy and swap. Rebuild the sets.
-      GroupType temp = containingNone;
-      GroupType::value_type masterSet;
-      masterSet.insert(aLabel); // Incase it doesn't already contain a
-      masterSet.insert(bLabel); // Incase it doesn't already contain b
-      for (auto &childSet : containingAny) {
-        masterSet.insert(childSet.begin(),
-                         childSet.end()); // Build the master set.
-      }
-      temp.push_back(masterSet);
-      m_groups = temp; // Swap.
-      newItem = false;
-    }
-    return newItem;
   }
 
   /**
@@ -104,14 +68,22 @@ public:
    * @return Merged composite clusters.
    */
   std::list<boost::shared_ptr<CompositeCluster>> makeCompositeClusters() {
-    std::list<boost::shared_ptr<CompositeCluster>> composites;
-    for (auto &labelSet : m_groups) {
-      auto composite = boost::make_shared<CompositeCluster>();
-      for (auto j : labelSet) {
-        boost::shared_ptr<ICluster> &cluster = m_register[j];
-        composite->add(cluster);
+    std::map<size_t, boost::shared_ptr<CompositeCluster>> groups;
+    std::vector<size_t> labels;
+    labels.reserve(m_parents.size());
+    for (const auto &parent : m_parents) {
+      labels.push_back(parent.first);
+    }
+    for (auto label : labels) {
+      auto &composite = groups[find(label)];
+      if (!composite) {
+        composite = boost::make_shared<CompositeCluster>();
       }
-      composites.push_back(composite);
+      composite->add(m_register[label]);
+    }
+    std::list<boost::shared_ptr<CompositeCluster>> composites;
+    for (auto &group : groups) {
+      composites.push_back(group.second);
     }
     return composites;
   }
@@ -145,20 +117,9 @@ void ClusterRegister::add(const size_t &label,
 void ClusterRegister::merge(const DisjointElement &a,
                             const DisjointElement &b) const {
   if (!a.isEmpty() && !b.isEmpty()) {
-    const int &aId = a.getId();
-    const int &bId = b.getId();
-
-    size_t hash = m_Impl->m_labelHasher(ordered_pair(aId, bId));
-    if (m_Impl->m_labelHash.find(hash) ==
-        m_Impl->m_labelHash.end()) // Only if this pair combination has not
-                                   // already been processed
-    {
-      m_Impl->insert(a, b);
-      m_Impl->m_unique.erase(aId);
-      m_Impl->m_unique.erase(bId);
-      m_Impl->m_labelHash.insert(
-          hash); // So that we don't process this pair again.
-    }
+    m_Impl->insert(a, b);
+    m_Impl->m_unique.erase(a.getId());
+    m_Impl->m_unique.erase(b.getId());
   }
 }
 
@@ -15,6 +15,8 @@
 #include "MantidCrystal/ICluster.h"
 #include "MantidKernel/Memory.h"
 
+#include <exception>
+
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
 using namespace Mantid::Crystal::ConnectedComponentMappingTypes;
@@ -304,45 +306,58 @@ ClusterMap ConnectedComponentLabeling::calculateDisjointTree(
         parallelClusterMapVec(nThreadsToUse);
 
     // ------------- Stage One. Local CCL in parallel.
+    // Each iterator only labels and joins the elements within its own bounds,
+    // so the threads never touch the same DisjointElements. Links across
+    // iterator bounds are recorded and resolved in Stage 2.
     g_log.debug("Parallel solve local CCL");
-    // PARALLEL_FOR_NO_WSP_CHECK()
+    std::exception_ptr error;
+    PARALLEL_FOR_NO_WSP_CHECK()
     for (int i = 0; i < nThreadsToUse; ++i) {
-      API::IMDIterator *iterator = iterators[i].get();
-      boost::scoped_ptr<BackgroundStrategy> strategy(
-          baseStrategy->clone());                     // local strategy
-      VecEdgeIndexPair &edgeVec = parallelEdgeVec[i]; // local edge indexes
-
-      const size_t startLabel =
-          m_startId + (i * maxClustersPossible); // Ensure that label ids are
-                                                 // totally unique within each
-                                                 // parallel unit.
-      const size_t endLabel = doConnectedComponentLabeling(
-          iterator, strategy.get(), neighbourElements, progress, maxNeighbours,
-          startLabel, edgeVec);
-
-      // Create clusters from labels.
-      std::map<size_t, boost::shared_ptr<Cluster>> &localClusterMap =
-          parallelClusterMapVec[i]; // local cluster map.
-      for (size_t labelId = startLabel; labelId != endLabel; ++labelId) {
-        auto cluster = boost::make_shared<Cluster>(
-            labelId); // Create a cluster for the label and key it by the label.
-        localClusterMap[labelId] = cluster;
-      }
+      try {
+        API::IMDIterator *iterator = iterators[i].get();
+        boost::scoped_ptr<BackgroundStrategy> strategy(
+            baseStrategy->clone());                     // local strategy
+        VecEdgeIndexPair &edgeVec = parallelEdgeVec[i]; // local edge indexes
+
+        // Ensure that label ids are totally unique within each parallel unit.
+        const size_t startLabel = m_startId + (i * maxClustersPossible);
+        const size_t endLabel = doConnectedComponentLabeling(
+            iterator, strategy.get(), neighbourElements, progress,
+            maxNeighbours, startLabel, edgeVec);
+
+        // Create clusters from labels.
+        std::map<size_t, boost::shared_ptr<Cluster>> &localClusterMap =
+            parallelClusterMapVec[i]; // local cluster map.
+        for (size_t labelId = startLabel; labelId != endLabel; ++labelId) {
+          // Create a cluster for the label and key it by the label.
+          auto cluster = boost::make_shared<Cluster>(labelId);
+          localClusterMap[labelId] = cluster;
+        }
 
-      // Associate the member DisjointElements with a cluster. Involves looping
-      // back over iterator.
-      iterator->jumpTo(0); // Reset
-      do {
-        if (!baseStrategy->isBackground(iterator)) {
-          // Second pass smoothing step
-          const size_t currentIndex = iterator->getLinearIndex();
-
-          const size_t &labelAtIndex =
-              neighbourElements[currentIndex].getRoot();
-          localClusterMap[labelAtIndex]->addIndex(currentIndex);
+        // Associate the member DisjointElements with a cluster. Involves
+        // looping back over iterator.
+        iterator->jumpTo(0); // Reset
+        do {
+          if (!strategy->isBackground(iterator)) {
+            // Second pass smoothing step
+            const size_t currentIndex = iterator->getLinearIndex();
+
+            const size_t &labelAtIndex =
+                neighbourElements[currentIndex].getRoot();
+            localClusterMap[labelAtIndex]->addIndex(currentIndex);
+          }
+        } while (iterator->next());
+      } catch (...) {
+        // Exceptions must not escape the parallel region, e.g. a
+        // CancelException thrown by the progress reporting
+        PARALLEL_CRITICAL(ConnectedComponentLabeling_error) {
+          if (!error)
+            error = std::current_exception();
         }
-      } while (iterator->next());
+      }
     }
+    if (error)
+      std::rethrow_exception(error);
 
     // -------------------- Stage 2 --- Preparation stage for combining
     // equivalent clusters. Must be done in sequence.
@@ -13,6 +13,8 @@
 #include "MockObjects.h"
 #include <boost/make_shared.hpp>
 #include <cxxtest/TestSuite.h>
+#include <numeric>
+#include <vector>
 
 using namespace Mantid::Crystal;
 using namespace testing;
@@ -147,6 +149,90 @@ public:
     auto label = clusters[1]->getLabel();
     TSM_ASSERT_EQUALS("Entire clustere labeled as minimum (1)", label, 1);
   }
+
+  void test_chained_merge_is_labelled_with_smallest_label_of_the_group() {
+    // Merge (7,5) (6,2) then (5,6). The smallest label is in the second pair.
+    ClusterRegister cRegister;
+    addClusters(cRegister, {2, 5, 6, 7, 9});
+
+    cRegister.merge(DisjointElement(7), DisjointElement(5));
+    cRegister.merge(DisjointElement(6), DisjointElement(2));
+    cRegister.merge(DisjointElement(5), DisjointElement(6));
+
+    auto clusters = cRegister.clusters();
+    TS_ASSERT_EQUALS(clusters.size(), 2);
+    TS_ASSERT(boost::dynamic_pointer_cast<CompositeCluster>(clusters[2]));
+    TS_ASSERT_EQUALS(clusters[2]->size(), 4);
+    TS_ASSERT_EQUALS(clusters[2]->getLabel(), 2);
+    TSM_ASSERT("Cluster 9 was never merged",
+               boost::dynamic_pointer_cast<Cluster>(clusters[9]));
+  }
+
+  void test_repeated_merges_add_each_cluster_once() {
+    ClusterRegister cRegister;
+    addClusters(cRegister, {1, 2, 3});
+
+    for (int i = 0; i < 3; ++i) {
+      cRegister.merge(DisjointElement(2), DisjointElement(3));
+      cRegister.merge(DisjointElement(3), DisjointElement(2));
+    }
+    cRegister.merge(DisjointElement(1), DisjointElement(3));
+    cRegister.merge(DisjointElement(1), DisjointElement(2));
+    cRegister.merge(DisjointElement(2), DisjointElement(1));
+
+    auto clusters = cRegister.clusters();
+    TS_ASSERT_EQUALS(clusters.size(), 1);
+    TSM_ASSERT_EQUALS("Each merged cluster is owned once by the composite",
+                      clusters[1]->size(), 3);
+  }
+
+  void test_separate_groups_stay_separate() {
+    ClusterRegister cRegister;
+    addClusters(cRegister, {1, 2, 3, 4, 5, 6, 7});
+
+    cRegister.merge(DisjointElement(1), DisjointElement(2));
+    cRegister.merge(DisjointElement(4), DisjointElement(3));
+    cRegister.merge(DisjointElement(6), DisjointElement(5));
+
+    auto clusters = cRegister.clusters();
+    TS_ASSERT_EQUALS(clusters.size(), 4);
+    for (const size_t label : {1, 3, 5}) {
+      TS_ASSERT(boost::dynamic_pointer_cast<CompositeCluster>(clusters[label]));
+      TS_ASSERT_EQUALS(clusters[label]->size(), 2);
+    }
+    TS_ASSERT(boost::dynamic_pointer_cast<Cluster>(clusters[7]));
+  }
+
+  void test_long_chain_of_merges_forms_one_group() {
+    // Merging (19,20), (18,19), ..., (1,2) links every label to the next
+    // smaller one, so finding the representative has to walk a long path.
+    const size_t nClusters = 20;
+    ClusterRegister cRegister;
+    std::vector<size_t> labels(nClusters);
+    std::iota(labels.begin(), labels.end(), 1);
+    addClusters(cRegister, labels);
+
+    for (size_t label = nClusters - 1; label > 0; --label) {
+      cRegister.merge(DisjointElement(static_cast<int>(label)),
+                      DisjointElement(static_cast<int>(label + 1)));
+    }
+
+    auto clusters = cRegister.clusters();
+    TS_ASSERT_EQUALS(clusters.size(), 1);
+    TS_ASSERT_EQUALS(clusters[1]->size(), nClusters);
+    TS_ASSERT_EQUALS(clusters[1]->getLabel(), 1);
+  }
+
+private:
+  /// Register a cluster holding a single index for each label
+  void addClusters(ClusterRegister &cRegister,
+                   const std::vector<size_t> &labels) {
+    for (const auto label : labels) {
+      auto cluster = boost::make_shared<Cluster>(label);
+      cluster->addIndex(0);
+      cRegister.add(label, cluster);
+    }
+  }
 };
 
 #endif /* MANTID_CRYSTAL_CLUSTERREGISTERTEST_H_ */
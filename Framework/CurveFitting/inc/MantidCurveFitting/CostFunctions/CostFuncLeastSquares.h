@@ -18,6 +18,9 @@ namespace Mantid {
 namespace CurveFitting {
 class SeqDomain;
 class ParDomain;
+namespace FuncMinimisers {
+class LevenbergMarquardtBlockMinimizer;
+} // namespace FuncMinimisers
 
 namespace CostFunctions {
 /** Cost function for least squares
@@ -84,6 +87,7 @@ protected:
 
   friend class CurveFitting::SeqDomain;
   friend class CurveFitting::ParDomain;
+  friend class CurveFitting::FuncMinimisers::LevenbergMarquardtBlockMinimizer;
 
   double m_factor;
 };
@@ -0,0 +1,150 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_CURVEFITTING_LEVENBERGMARQUARDTBLOCKMINIMIZER_H_
+#define MANTID_CURVEFITTING_LEVENBERGMARQUARDTBLOCKMINIMIZER_H_
+
+//----------------------------------------------------------------------
+// Includes
+//----------------------------------------------------------------------
+#include "MantidAPI/IFuncMinimizer.h"
+#include "MantidCurveFitting/GSLMatrix.h"
+#include "MantidCurveFitting/GSLVector.h"
+
+namespace Mantid {
+namespace API {
+class CompositeDomain;
+class FunctionValues;
+class MultiDomainFunction;
+class ParameterTie;
+} // namespace API
+
+namespace CurveFitting {
+namespace CostFunctions {
+class CostFuncLeastSquares;
+} // namespace CostFunctions
+
+namespace FuncMinimisers {
+/** Implementing Levenberg-Marquardt algorithm for fits with many parameters
+    that are each local to a single domain of a MultiDomainFunction, plus a
+    smaller number of parameters shared between the domains.
+
+    The Jacobian is calculated numerically domain by domain and in parallel:
+    a local parameter is only varied on its own domain. Member functions
+    applied to more than one domain are evaluated serially, as a function
+    object must not be evaluated by two threads at once. The hessian is kept in
+    blocks, one for the local parameters of each domain, one for the shared
+    parameters and one coupling the two for each domain. The normal system is
+    solved by eliminating the local parameters, which leaves a system the size
+    of the number of shared parameters (the Schur complement).
+
+    Any other fit is treated as having shared parameters only, which reduces
+    to the method of LevenbergMarquardtMDMinimizer.
+*/
+class DLLExport LevenbergMarquardtBlockMinimizer : public API::IFuncMinimizer {
+public:
+  /// Constructor
+  LevenbergMarquardtBlockMinimizer();
+  /// Name of the minimizer.
+  std::string name() const override { return "Levenberg-MarquardtBlock"; }
+
+  /// Initialize minimizer, i.e. pass a function to minimize.
+  void initialize(API::ICostFunction_sptr function,
+                  size_t maxIterations = 0) override;
+  /// Do one iteration.
+  bool iterate(size_t iteration) override;
+  /// Return current value of the cost function
+  double costFunctionVal() override;
+
+private:
+  /// The parameters and hessian blocks of a single domain
+  struct Block {
+    /// Index of the domain in the composite domain
+    size_t domain{0};
+    /// Offset of the domain's values in the composite values
+    size_t valueOffset{0};
+    /// Member functions applied to this domain only
+    std::vector<size_t> functions;
+    /// Member functions applied to this and other domains
+    std::vector<size_t> sharedFunctions;
+    /// Active indices of the parameters local to the domain
+    std::vector<size_t> local;
+    /// Positions in m_global of the shared parameters the domain depends on
+    std::vector<size_t> global;
+    /// Values calculated on the domain at the current parameters
+    std::vector<double> calculated;
+    /// Values of the shared member functions at the current parameters
+    std::vector<double> sharedCalculated;
+    /// Derivatives of the calculated values with respect to the local
+    /// parameters followed by the shared ones
+    GSLMatrix jacobian;
+    /// Hessian of the local parameters
+    GSLMatrix localHessian;
+    /// Mixed hessian of the local and the shared parameters
+    GSLMatrix mixedHessian;
+    /// Derivatives of the cost function by the local parameters
+    GSLVector localDeriv;
+    /// Damped local hessian solved for the mixed hessian
+    GSLMatrix elimination;
+    /// Damped local hessian solved for the local derivatives
+    GSLVector localStep;
+  };
+
+  void setUpBlocks();
+  void calculateDerivatives();
+  void calculateJacobians();
+  void calculateHessians();
+  void calculateDomain(size_t domain, const std::vector<size_t> &functions,
+                       std::vector<double> &calculated) const;
+  void perturb(size_t iActive, double value);
+  double hessianDiagonal(size_t iActive) const;
+  bool solve(GSLVector &dx);
+  double hessianProduct(const GSLVector &dx) const;
+
+  /// Pointer to the cost function. Must be the least squares.
+  boost::shared_ptr<CostFunctions::CostFuncLeastSquares> m_leastSquares;
+  /// The fitting function if it is a MultiDomainFunction
+  boost::shared_ptr<API::MultiDomainFunction> m_function;
+  /// The fitting domain if the function is a MultiDomainFunction
+  boost::shared_ptr<API::CompositeDomain> m_domain;
+  /// The domain blocks. Empty if the fit has no block structure.
+  std::vector<Block> m_blocks;
+  /// Active indices of the parameters shared between domains
+  std::vector<size_t> m_global;
+  /// The blocks depending on each shared parameter
+  std::vector<std::vector<size_t>> m_globalBlocks;
+  /// Position of each active parameter in its block's local parameters or
+  /// in m_global
+  std::vector<size_t> m_position;
+  /// Index of the block owning each active parameter, or the number of
+  /// blocks if the parameter is shared between domains
+  std::vector<size_t> m_owner;
+  /// The declared index of each active parameter
+  std::vector<size_t> m_declaredIndex;
+  /// The ties to re-evaluate when an active parameter changes
+  std::vector<std::vector<API::ParameterTie *>> m_dependentTies;
+  /// Hessian of the shared parameters
+  GSLMatrix m_globalHessian;
+  /// Derivatives of the cost function by all active parameters
+  GSLVector m_deriv;
+  /// The tau parameter in the Levenberg-Marquardt method.
+  double m_tau;
+  /// The damping mu parameter in the Levenberg-Marquardt method.
+  double m_mu;
+  /// The nu parameter in the Levenberg-Marquardt method.
+  double m_nu;
+  /// The rho parameter in the Levenberg-Marquardt method.
+  double m_rho;
+  /// To keep function value
+  double m_F;
+  std::vector<double> m_D;
+};
+
+} // namespace FuncMinimisers
+} // namespace CurveFitting
+} // namespace Mantid
+
+#endif /*MANTID_CURVEFITTING_LEVENBERGMARQUARDTBLOCKMINIMIZER_H_*/
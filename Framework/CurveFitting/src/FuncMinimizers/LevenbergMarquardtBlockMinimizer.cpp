@@ -0,0 +1,757 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+//----------------------------------------------------------------------
+// Includes
+//----------------------------------------------------------------------
+#include "MantidCurveFitting/FuncMinimizers/LevenbergMarquardtBlockMinimizer.h"
+#include "MantidCurveFitting/CostFunctions/CostFuncLeastSquares.h"
+
+#include "MantidAPI/CompositeDomain.h"
+#include "MantidAPI/FuncMinimizerFactory.h"
+#include "MantidAPI/FunctionValues.h"
+#include "MantidAPI/IConstraint.h"
+#include "MantidAPI/MultiDomainFunction.h"
+#include "MantidAPI/ParameterTie.h"
+
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <gsl/gsl_blas.h>
+#include <iterator>
+#include <limits>
+#include <numeric>
+
+namespace Mantid {
+namespace CurveFitting {
+namespace FuncMinimisers {
+namespace {
+/// static logger object
+Kernel::Logger g_log("LevenbergMarquardtBlock");
+
+/// The step used to calculate a numerical derivative by a parameter. The
+/// same as in IFunction::calNumericalDeriv.
+double derivativeStep(double value) {
+  constexpr double epsilon = std::numeric_limits<double>::epsilon() * 100;
+  constexpr double stepPercentage = 0.001;
+  constexpr double cutoff =
+      100.0 * std::numeric_limits<double>::min() / stepPercentage;
+  return fabs(value) < cutoff ? epsilon : value * stepPercentage;
+}
+
+/// Call func(i) for i in [0, n) in parallel and rethrow the first exception
+/// thrown by any of the calls.
+template <typename Func> void parallelFor(size_t n, const Func &func) {
+  std::exception_ptr error;
+  const auto count = static_cast<int64_t>(n);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < count; ++i) {
+    try {
+      func(static_cast<size_t>(i));
+    } catch (...) {
+      PARALLEL_CRITICAL(LevenbergMarquardtBlock_error) {
+        if (!error) {
+          error = std::current_exception();
+        }
+      }
+    }
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+} // namespace
+
+// clang-format off
+DECLARE_FUNCMINIMIZER(LevenbergMarquardtBlockMinimizer, Levenberg-MarquardtBlock)
+// clang-format on
+
+/// Constructor
+LevenbergMarquardtBlockMinimizer::LevenbergMarquardtBlockMinimizer()
+    : IFuncMinimizer(), m_tau(1e-6), m_mu(1e-6), m_nu(2.0), m_rho(1.0),
+      m_F(0.0) {
+  declareProperty("MuMax", 1e6,
+                  "Maximum value of mu - a stopping parameter in failure.");
+  declareProperty("AbsError", 0.0001,
+                  "Absolute error allowed for parameters - "
+                  "a stopping parameter in success.");
+  declareProperty("Verbose", false, "Make output more verbose.");
+}
+
+/// Initialize minimizer, i.e. pass a function to minimize.
+void LevenbergMarquardtBlockMinimizer::initialize(
+    API::ICostFunction_sptr function, size_t /*maxIterations*/) {
+  m_leastSquares =
+      boost::dynamic_pointer_cast<CostFunctions::CostFuncLeastSquares>(
+          function);
+  if (!m_leastSquares) {
+    throw std::invalid_argument("Levenberg-Marquardt minimizer works only with "
+                                "least squares. Different function was given.");
+  }
+  m_mu = 0;
+  m_nu = 2.0;
+  m_rho = 1.0;
+  m_D.clear();
+  setUpBlocks();
+}
+
+/**
+ * Sort the active parameters into the ones local to a single domain and the
+ * ones shared between domains. A parameter is shared if it, or any parameter
+ * tied to it, is used on more than one domain. If the fit isn't a
+ * MultiDomainFunction on a CompositeDomain all parameters are shared.
+ */
+void LevenbergMarquardtBlockMinimizer::setUpBlocks() {
+  m_blocks.clear();
+  m_global.clear();
+  m_globalBlocks.clear();
+  m_declaredIndex.clear();
+  m_dependentTies.clear();
+
+  auto function = m_leastSquares->getFittingFunction();
+  for (size_t i = 0; i < function->nParams(); ++i) {
+    if (function->isActive(i)) {
+      m_declaredIndex.push_back(i);
+    }
+  }
+  const size_t nActive = m_declaredIndex.size();
+
+  m_function = boost::dynamic_pointer_cast<API::MultiDomainFunction>(function);
+  m_domain = boost::dynamic_pointer_cast<API::CompositeDomain>(
+      m_leastSquares->getDomain());
+  if (!m_function || !m_domain) {
+    m_function.reset();
+    m_domain.reset();
+    m_global.resize(nActive);
+    std::iota(m_global.begin(), m_global.end(), 0);
+    m_position = m_global;
+    m_owner.assign(nActive, 0);
+    return;
+  }
+
+  // The domains each member function is applied to
+  const size_t nDomains = m_domain->getNParts();
+  const size_t nFunctions = m_function->nFunctions();
+  std::vector<std::vector<size_t>> memberDomains(nFunctions);
+  m_blocks.resize(nDomains);
+  size_t offset = 0;
+  for (size_t i = 0; i < nDomains; ++i) {
+    m_blocks[i].domain = i;
+    m_blocks[i].valueOffset = offset;
+    offset += m_domain->getDomain(i).size();
+  }
+  for (size_t iFun = 0; iFun < nFunctions; ++iFun) {
+    m_function->getDomainIndices(iFun, nDomains, memberDomains[iFun]);
+    const bool shared = memberDomains[iFun].size() > 1;
+    for (auto domain : memberDomains[iFun]) {
+      if (domain >= nDomains) {
+        throw std::invalid_argument(
+            "CompositeDomain has too few parts for MultiDomainFunction.");
+      }
+      auto &functions = shared ? m_blocks[domain].sharedFunctions
+                               : m_blocks[domain].functions;
+      functions.push_back(iFun);
+    }
+  }
+
+  // The parameters tied to each parameter
+  const size_t nParams = m_function->nParams();
+  std::vector<std::vector<size_t>> tiedTo(nParams);
+  for (size_t i = 0; i < nParams; ++i) {
+    auto tie = m_function->getTie(i);
+    if (!tie) {
+      continue;
+    }
+    for (const auto &reference : tie->getRHSParameters()) {
+      const size_t j = m_function->getParameterIndex(reference);
+      if (j < nParams) {
+        tiedTo[j].push_back(i);
+      }
+    }
+  }
+
+  m_owner.resize(nActive);
+  m_position.resize(nActive);
+  m_dependentTies.resize(nActive);
+  std::vector<size_t> visited(nParams, nActive);
+  for (size_t iActive = 0; iActive < nActive; ++iActive) {
+    // Collect the parameters that change with this one
+    const size_t declared = m_declaredIndex[iActive];
+    std::vector<size_t> changed{declared};
+    visited[declared] = iActive;
+    for (size_t k = 0; k < changed.size(); ++k) {
+      for (auto i : tiedTo[changed[k]]) {
+        if (visited[i] != iActive) {
+          visited[i] = iActive;
+          changed.push_back(i);
+        }
+      }
+    }
+    std::vector<size_t> domains;
+    for (auto i : changed) {
+      const auto &indices = memberDomains[m_function->functionIndex(i)];
+      domains.insert(domains.end(), indices.begin(), indices.end());
+    }
+    std::sort(domains.begin(), domains.end());
+    domains.erase(std::unique(domains.begin(), domains.end()), domains.end());
+    // Re-evaluate the ties in the order applyTies() would
+    std::sort(changed.begin() + 1, changed.end());
+    for (auto it = changed.begin() + 1; it != changed.end(); ++it) {
+      m_dependentTies[iActive].push_back(m_function->getTie(*it));
+    }
+
+    if (domains.size() == 1) {
+      auto &block = m_blocks[domains.front()];
+      m_owner[iActive] = domains.front();
+      m_position[iActive] = block.local.size();
+      block.local.push_back(iActive);
+    } else {
+      m_owner[iActive] = nDomains;
+      m_position[iActive] = m_global.size();
+      for (auto domain : domains) {
+        m_blocks[domain].global.push_back(m_global.size());
+      }
+      m_global.push_back(iActive);
+      m_globalBlocks.push_back(std::move(domains));
+    }
+  }
+}
+
+/// Calculate the derivatives and the hessian of the cost function at the
+/// current parameters.
+void LevenbergMarquardtBlockMinimizer::calculateDerivatives() {
+  if (!m_function) {
+    m_leastSquares->valDerivHessian();
+    m_deriv = m_leastSquares->getDeriv();
+    m_globalHessian = m_leastSquares->getHessian();
+    return;
+  }
+  calculateJacobians();
+  calculateHessians();
+}
+
+/**
+ * Calculate the values and the numerical jacobian of each block. The local
+ * parameters of different blocks are varied in parallel; each shared
+ * parameter is varied in turn and the blocks depending on it are evaluated
+ * in parallel. Member functions applied to several domains are always
+ * evaluated serially: they don't depend on local parameters, and evaluating
+ * the same function object on several threads at once isn't safe for
+ * functions that cache intermediate results.
+ */
+void LevenbergMarquardtBlockMinimizer::calculateJacobians() {
+  m_function->applyTies();
+  for (auto &block : m_blocks) {
+    calculateDomain(block.domain, block.sharedFunctions,
+                    block.sharedCalculated);
+  }
+
+  parallelFor(m_blocks.size(), [this](size_t i) {
+    auto &block = m_blocks[i];
+    std::vector<double> local, shiftedLocal;
+    calculateDomain(block.domain, block.functions, local);
+    const size_t ny = local.size();
+    block.calculated.resize(ny);
+    for (size_t k = 0; k < ny; ++k) {
+      block.calculated[k] = local[k] + block.sharedCalculated[k];
+    }
+    const size_t nLocal = block.local.size();
+    if (ny == 0 || nLocal + block.global.size() == 0) {
+      return;
+    }
+    block.jacobian.resize(ny, nLocal + block.global.size());
+    for (size_t j = 0; j < nLocal; ++j) {
+      const size_t iActive = block.local[j];
+      const double value =
+          m_function->activeParameter(m_declaredIndex[iActive]);
+      const double shifted = value + derivativeStep(value);
+      perturb(iActive, shifted);
+      calculateDomain(block.domain, block.functions, shiftedLocal);
+      perturb(iActive, value);
+      const double step = shifted - value;
+      for (size_t k = 0; k < ny; ++k) {
+        block.jacobian(k, j) = (shiftedLocal[k] - local[k]) / step;
+      }
+    }
+  });
+
+  for (size_t iGlobal = 0; iGlobal < m_global.size(); ++iGlobal) {
+    const size_t iActive = m_global[iGlobal];
+    const double value = m_function->activeParameter(m_declaredIndex[iActive]);
+    const double shifted = value + derivativeStep(value);
+    const double step = shifted - value;
+    const auto &blocks = m_globalBlocks[iGlobal];
+    perturb(iActive, shifted);
+    std::vector<std::vector<double>> shiftedShared(blocks.size());
+    for (size_t i = 0; i < blocks.size(); ++i) {
+      const auto &block = m_blocks[blocks[i]];
+      calculateDomain(block.domain, block.sharedFunctions, shiftedShared[i]);
+    }
+    parallelFor(blocks.size(), [&](size_t i) {
+      auto &block = m_blocks[blocks[i]];
+      const size_t ny = block.calculated.size();
+      if (ny == 0) {
+        return;
+      }
+      std::vector<double> shiftedLocal;
+      calculateDomain(block.domain, block.functions, shiftedLocal);
+      const auto position = std::lower_bound(block.global.begin(),
+                                             block.global.end(), iGlobal);
+      const size_t column =
+          block.local.size() +
+          static_cast<size_t>(std::distance(block.global.begin(), position));
+      for (size_t k = 0; k < ny; ++k) {
+        block.jacobian(k, column) =
+            (shiftedLocal[k] + shiftedShared[i][k] - block.calculated[k]) /
+            step;
+      }
+    });
+    perturb(iActive, value);
+  }
+}
+
+/**
+ * Calculate the derivatives of the cost function and the blocks of its
+ * hessian from the jacobians of the blocks.
+ */
+void LevenbergMarquardtBlockMinimizer::calculateHessians() {
+  const auto values = m_leastSquares->getValues();
+  const auto weights = m_leastSquares->getFitWeights(values);
+  const size_t nGlobal = m_global.size();
+  m_deriv.resize(m_declaredIndex.size());
+  m_deriv.zero();
+  if (nGlobal > 0) {
+    m_globalHessian.resize(nGlobal, nGlobal);
+    m_globalHessian.zero();
+  }
+
+  parallelFor(m_blocks.size(), [&](size_t i) {
+    auto &block = m_blocks[i];
+    const size_t ny = block.calculated.size();
+    const size_t nLocal = block.local.size();
+    const size_t nShared = block.global.size();
+    if (nLocal > 0) {
+      block.localHessian.resize(nLocal, nLocal);
+      block.localHessian.zero();
+      block.localDeriv.resize(nLocal);
+      block.localDeriv.zero();
+      if (nShared > 0) {
+        block.mixedHessian.resize(nLocal, nShared);
+        block.mixedHessian.zero();
+      }
+    }
+    if (ny == 0 || nLocal + nShared == 0) {
+      return;
+    }
+
+    // Weight the jacobian and the residuals
+    GSLVector residual(ny);
+    for (size_t k = 0; k < ny; ++k) {
+      const size_t iy = block.valueOffset + k;
+      const double w = weights[iy];
+      residual[k] = (block.calculated[k] - values->getFitData(iy)) * w;
+      for (size_t j = 0; j < nLocal + nShared; ++j) {
+        block.jacobian(k, j) *= w;
+      }
+    }
+
+    GSLMatrix local;
+    if (nLocal > 0) {
+      local = GSLMatrix(block.jacobian, 0, 0, ny, nLocal);
+      block.localHessian = local.tr() * local;
+      gsl_blas_dgemv(CblasTrans, 1.0, local.gsl(), residual.gsl(), 0.0,
+                     block.localDeriv.gsl());
+      for (size_t j = 0; j < nLocal; ++j) {
+        m_deriv[block.local[j]] = block.localDeriv[j];
+      }
+    }
+    if (nShared > 0) {
+      GSLMatrix shared(block.jacobian, 0, nLocal, ny, nShared);
+      if (nLocal > 0) {
+        block.mixedHessian = local.tr() * shared;
+      }
+      const GSLMatrix sharedHessian = shared.tr() * shared;
+      GSLVector sharedDeriv(nShared);
+      gsl_blas_dgemv(CblasTrans, 1.0, shared.gsl(), residual.gsl(), 0.0,
+                     sharedDeriv.gsl());
+      PARALLEL_CRITICAL(LevenbergMarquardtBlock_hessian) {
+        for (size_t a = 0; a < nShared; ++a) {
+          m_deriv[m_global[block.global[a]]] += sharedDeriv[a];
+          for (size_t b = 0; b < nShared; ++b) {
+            m_globalHessian(block.global[a], block.global[b]) +=
+                sharedHessian(a, b);
+          }
+        }
+      }
+    }
+  });
+
+  // Add constraints penalty
+  if (m_leastSquares->m_includePenalty) {
+    for (size_t iActive = 0; iActive < m_declaredIndex.size(); ++iActive) {
+      API::IConstraint *c = m_function->getConstraint(m_declaredIndex[iActive]);
+      if (!c) {
+        continue;
+      }
+      m_deriv[iActive] += c->checkDeriv();
+      const size_t pos = m_position[iActive];
+      if (m_owner[iActive] < m_blocks.size()) {
+        m_blocks[m_owner[iActive]].localHessian(pos, pos) += c->checkDeriv2();
+      } else {
+        m_globalHessian(pos, pos) += c->checkDeriv2();
+      }
+    }
+  }
+}
+
+/**
+ * Calculate the sum of some of the member functions on a domain.
+ * @param domain :: Index of the domain in the composite domain
+ * @param functions :: Indices of the member functions to sum
+ * @param calculated :: Receives the sum, zero if there are no functions
+ */
+void LevenbergMarquardtBlockMinimizer::calculateDomain(
+    size_t domain, const std::vector<size_t> &functions,
+    std::vector<double> &calculated) const {
+  const auto &part = m_domain->getDomain(domain);
+  calculated.assign(part.size(), 0.0);
+  for (auto iFun : functions) {
+    API::FunctionValues values(part);
+    m_function->getFunction(iFun)->function(part, values);
+    for (size_t k = 0; k < calculated.size(); ++k) {
+      calculated[k] += values.getCalculated(k);
+    }
+  }
+}
+
+/// Set an active parameter and update the parameters tied to it.
+void LevenbergMarquardtBlockMinimizer::perturb(size_t iActive, double value) {
+  m_function->setActiveParameter(m_declaredIndex[iActive], value);
+  for (auto tie : m_dependentTies[iActive]) {
+    tie->eval();
+  }
+}
+
+/// The diagonal element of the undamped hessian for an active parameter.
+double LevenbergMarquardtBlockMinimizer::hessianDiagonal(size_t iActive) const {
+  const size_t pos = m_position[iActive];
+  if (m_owner[iActive] < m_blocks.size()) {
+    return m_blocks[m_owner[iActive]].localHessian.get(pos, pos);
+  }
+  return m_globalHessian.get(pos, pos);
+}
+
+/**
+ * Solve the damped system H * dx == -deriv. The system is scaled to have a
+ * unit diagonal. The local parameters of each block are eliminated in
+ * parallel, then the system for the shared parameters is solved and the
+ * local corrections are substituted back.
+ * @param dx :: Receives the parameter corrections.
+ * @return false if the system cannot be solved; m_errorString is set.
+ */
+bool LevenbergMarquardtBlockMinimizer::solve(GSLVector &dx) {
+  const size_t n = m_deriv.size();
+  std::vector<double> sf(n);
+  for (size_t i = 0; i < n; ++i) {
+    double d = fabs(m_deriv.get(i));
+    if (m_D[i] > d)
+      d = m_D[i];
+    m_D[i] = d;
+    const double tmp = hessianDiagonal(i) + m_mu * d;
+    sf[i] = sqrt(tmp);
+    if (tmp == 0.0) {
+      m_errorString = "Function doesn't depend on parameter " +
+                      m_leastSquares->parameterName(i);
+      return false;
+    }
+  }
+
+  // The scaled and damped system of the shared parameters
+  const size_t nGlobal = m_global.size();
+  GSLMatrix schur;
+  GSLVector rhs;
+  if (nGlobal > 0) {
+    schur.resize(nGlobal, nGlobal);
+    rhs.resize(nGlobal);
+    for (size_t a = 0; a < nGlobal; ++a) {
+      const size_t ia = m_global[a];
+      rhs[a] = -m_deriv.get(ia) / sf[ia];
+      for (size_t b = 0; b < nGlobal; ++b) {
+        schur(a, b) = a == b ? 1.0
+                             : m_globalHessian.get(a, b) /
+                                   (sf[ia] * sf[m_global[b]]);
+      }
+    }
+  }
+
+  try {
+    // Eliminate the local parameters
+    parallelFor(m_blocks.size(), [&](size_t i) {
+      auto &block = m_blocks[i];
+      const size_t nLocal = block.local.size();
+      const size_t nShared = block.global.size();
+      if (nLocal == 0) {
+        return;
+      }
+      GSLMatrix inverse(nLocal, nLocal);
+      block.localStep.resize(nLocal);
+      for (size_t j = 0; j < nLocal; ++j) {
+        const size_t ij = block.local[j];
+        block.localStep[j] = -m_deriv.get(ij) / sf[ij];
+        for (size_t k = 0; k < nLocal; ++k) {
+          inverse(j, k) =
+              j == k ? 1.0
+                     : block.localHessian.get(j, k) /
+                           (sf[ij] * sf[block.local[k]]);
+        }
+      }
+      inverse.invert();
+      block.localStep = inverse * block.localStep;
+      if (nShared == 0) {
+        return;
+      }
+      GSLMatrix mixed(nLocal, nShared);
+      for (size_t j = 0; j < nLocal; ++j) {
+        for (size_t a = 0; a < nShared; ++a) {
+          mixed(j, a) = block.mixedHessian.get(j, a) /
+                        (sf[block.local[j]] * sf[m_global[block.global[a]]]);
+        }
+      }
+      block.elimination = inverse * mixed;
+      const GSLMatrix reduced = mixed.tr() * block.elimination;
+      GSLVector reducedRHS(nShared);
+      gsl_blas_dgemv(CblasTrans, 1.0, mixed.gsl(), block.localStep.gsl(),
+                     0.0, reducedRHS.gsl());
+      PARALLEL_CRITICAL(LevenbergMarquardtBlock_schur) {
+        for (size_t a = 0; a < nShared; ++a) {
+          rhs[block.global[a]] -= reducedRHS[a];
+          for (size_t b = 0; b < nShared; ++b) {
+            schur(block.global[a], block.global[b]) -= reduced(a, b);
+          }
+        }
+      }
+    });
+
+    GSLVector globalStep;
+    if (nGlobal > 0) {
+      schur.solve(rhs, globalStep);
+      for (size_t a = 0; a < nGlobal; ++a) {
+        dx[m_global[a]] = globalStep[a] / sf[m_global[a]];
+      }
+    }
+
+    // Substitute the shared corrections back
+    parallelFor(m_blocks.size(), [&](size_t i) {
+      auto &block = m_blocks[i];
+      for (size_t j = 0; j < block.local.size(); ++j) {
+        double step = block.localStep[j];
+        for (size_t a = 0; a < block.global.size(); ++a) {
+          step -= block.elimination.get(j, a) * globalStep[block.global[a]];
+        }
+        dx[block.local[j]] = step / sf[block.local[j]];
+      }
+    });
+  } catch (std::runtime_error &error) {
+    m_errorString = error.what();
+    return false;
+  }
+  return true;
+}
+
+/// Calculate dx * H * dx with the undamped hessian.
+double
+LevenbergMarquardtBlockMinimizer::hessianProduct(const GSLVector &dx) const {
+  double result = 0.0;
+  for (size_t a = 0; a < m_global.size(); ++a) {
+    for (size_t b = 0; b < m_global.size(); ++b) {
+      result += dx.get(m_global[a]) * m_globalHessian.get(a, b) *
+                dx.get(m_global[b]);
+    }
+  }
+  for (const auto &block : m_blocks) {
+    for (size_t j = 0; j < block.local.size(); ++j) {
+      const double dxj = dx.get(block.local[j]);
+      for (size_t k = 0; k < block.local.size(); ++k) {
+        result += dxj * block.localHessian.get(j, k) * dx.get(block.local[k]);
+      }
+      for (size_t a = 0; a < block.global.size(); ++a) {
+        result += 2.0 * dxj * block.mixedHessian.get(j, a) *
+                  dx.get(m_global[block.global[a]]);
+      }
+    }
+  }
+  return result;
+}
+
+/// Do one iteration.
+bool LevenbergMarquardtBlockMinimizer::iterate(size_t /*iteration*/) {
+  const bool verbose = getProperty("Verbose");
+  const double muMax = getProperty("MuMax");
+  const double absError = getProperty("AbsError");
+
+  if (!m_leastSquares) {
+    throw std::runtime_error("Cost function isn't set up.");
+  }
+  size_t n = m_leastSquares->nParams();
+
+  if (n == 0) {
+    m_errorString = "No parameters to fit.";
+    return false;
+  }
+
+  if (m_mu > muMax) {
+    m_errorString = "Failed to converge, maximum mu reached.";
+    return false;
+  }
+
+  // calculate the first and second derivatives of the cost function.
+  if (m_mu == 0.0 || m_rho > 0) {
+    // calculate everything first time or
+    // if last iteration was good
+    m_F = m_leastSquares->val();
+    calculateDerivatives();
+  }
+  // else if m_rho < 0 last iteration was bad: reuse the derivatives
+
+  // Calculate damping to hessian
+  if (m_mu == 0) // first iteration or accidental zero
+  {
+    m_mu = m_tau;
+    m_nu = 2.0;
+  }
+
+  if (verbose) {
+    g_log.warning()
+        << "===========================================================\n";
+    g_log.warning() << "mu=" << m_mu << "\n\n";
+  }
+
+  if (m_D.empty()) {
+    m_D.resize(n);
+  }
+
+  // Parameter corrections
+  GSLVector dx(n);
+  if (!solve(dx)) {
+    return false;
+  }
+
+  if (verbose) {
+    g_log.warning() << "Corrections:\n";
+    for (size_t j = 0; j < n; ++j) {
+      g_log.warning() << dx.get(j) << ' ';
+    }
+    g_log.warning() << "\n\n";
+  }
+
+  // save previous state
+  GSLVector parameters(n);
+  m_leastSquares->getParameters(parameters);
+  const GSLVector saved(parameters);
+  // Update the parameters of the cost function.
+  parameters += dx;
+  m_leastSquares->setParameters(parameters);
+  if (verbose) {
+    for (size_t i = 0; i < n; ++i) {
+      g_log.warning() << "Parameter(" << i << ")=" << parameters[i] << '\n';
+    }
+  }
+  m_leastSquares->getFittingFunction()->applyTies();
+
+  // --- prepare for the next iteration --- //
+
+  // calculate the linear part of the change in cost function
+  // dL = - der * dx - 0.5 * dx * hessian * dx
+  const double dL = -m_deriv.dot(dx) - 0.5 * hessianProduct(dx);
+
+  double F1 = m_leastSquares->val();
+  if (verbose) {
+    g_log.warning() << '\n';
+    g_log.warning() << "Old cost function " << m_F << '\n';
+    g_log.warning() << "New cost function " << F1 << '\n';
+    g_log.warning() << "Linear part " << dL << '\n';
+  }
+
+  // Try the stop condition
+  if (m_rho >= 0) {
+    double dx_norm = gsl_blas_dnrm2(dx.gsl());
+    if (dx_norm < absError) {
+      if (verbose) {
+        g_log.warning() << "Successful fit, parameters changed by less than "
+                        << absError << '\n';
+      }
+      return false;
+    }
+    if (m_rho == 0) {
+      if (m_F != F1) {
+        this->m_errorString = "Failed to converge, rho == 0";
+      }
+      if (verbose) {
+        g_log.warning() << "Successful fit, cost function didn't change.\n";
+      }
+      return false;
+    }
+  }
+
+  if (fabs(dL) == 0.0) {
+    if (m_F == F1)
+      m_rho = 1.0;
+    else
+      m_rho = 0;
+  } else {
+    m_rho = (m_F - F1) / dL;
+    if (m_rho == 0) {
+      return false;
+    }
+  }
+  if (verbose) {
+    g_log.warning() << "rho=" << m_rho << '\n';
+  }
+
+  if (m_rho > 0) { // good progress, decrease m_mu but no more than by 1/3
+    // rho = 1 - (2*rho - 1)^3
+    m_rho = 2.0 * m_rho - 1.0;
+    m_rho = 1.0 - m_rho * m_rho * m_rho;
+    const double I3 = 1.0 / 3.0;
+    if (m_rho > I3)
+      m_rho = I3;
+    if (m_rho < 0.0001)
+      m_rho = 0.1;
+    m_mu *= m_rho;
+    m_nu = 2.0;
+    m_F = F1;
+    if (verbose) {
+      g_log.warning() << "Good iteration, accept new parameters.\n";
+      g_log.warning() << "rho=" << m_rho << '\n';
+    }
+  } else { // bad iteration. increase m_mu and revert changes to parameters
+    m_mu *= m_nu;
+    m_nu *= 2.0;
+    // undo parameter update, m_F is the cost function at these parameters
+    m_leastSquares->setParameters(saved);
+    if (verbose) {
+      g_log.warning()
+          << "Bad iteration, increase mu and revert changes to parameters.\n";
+    }
+  }
+
+  return true;
+}
+
+/// Return current value of the cost function
+double LevenbergMarquardtBlockMinimizer::costFunctionVal() {
+  if (!m_leastSquares) {
+    throw std::runtime_error("Cost function isn't set up.");
+  }
+  return m_leastSquares->val();
+}
+
+} // namespace FuncMinimisers
+} // namespace CurveFitting
+} // namespace Mantid
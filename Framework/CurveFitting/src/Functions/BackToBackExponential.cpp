@@ -132,13 +132,72 @@ void BackToBackExponential::function1D(double *out, const double *xValues,
 }
 
 /**
- * Evaluate function derivatives numerically.
+ * Evaluate function derivatives analytically.
+ *
+ * Both exponential terms have the form exp(arg)*erfc(u) where arg - u^2 is
+ * -(x-X0)^2/(2*S^2), so the derivatives of the erfc factors share a single
+ * gaussian term.
  */
 void BackToBackExponential::functionDeriv1D(Jacobian *jacobian,
                                             const double *xValues,
                                             const size_t nData) {
-  FunctionDomain1DView domain(xValues, nData);
-  this->calNumericalDeriv(domain, *jacobian);
+  const double I = getParameter(0);
+  const double a = getParameter(1);
+  const double b = getParameter(2);
+  const double x0 = getParameter(3);
+  const double s = getParameter(4);
+
+  // find the reasonable extent of the peak ~100 fwhm
+  double extent = expWidth();
+  if (s > extent)
+    extent = s;
+  extent *= 100;
+
+  // function1D uses sqrt(2 * s2) = sqrt(2) * |S| in the erfc arguments
+  const double s2 = s * s;
+  const double absS = std::fabs(s);
+  const double signS = std::copysign(1.0, s);
+  const double sqrt2s = M_SQRT2 * absS;
+  double normFactor = a * b / (a + b) / 2;
+  double dNormDa = b * b / (a + b) / (a + b) / 2;
+  double dNormDb = a * a / (a + b) / (a + b) / 2;
+  // Needed for IntegratePeaksMD for cylinder profile fitted with b=0
+  if (normFactor == 0.0) {
+    normFactor = 1.0;
+    dNormDa = 0.0;
+    dNormDb = 0.0;
+  }
+  for (size_t i = 0; i < nData; i++) {
+    const double diff = xValues[i] - x0;
+    if (fabs(diff) < extent) {
+      const double e1 = exp(a / 2 * (a * s2 + 2 * diff) +
+                            gsl_sf_log_erfc((a * s2 + diff) / sqrt2s));
+      const double e2 = exp(b / 2 * (b * s2 - 2 * diff) +
+                            gsl_sf_log_erfc((b * s2 - diff) / sqrt2s));
+      const double val = e1 + e2;
+      // 2/sqrt(pi) * exp(arg - u^2), common to both terms
+      const double g = M_2_SQRTPI * exp(-diff * diff / (2 * s2));
+
+      const double de1da = e1 * (a * s2 + diff) - g * absS / M_SQRT2;
+      const double de2db = e2 * (b * s2 - diff) - g * absS / M_SQRT2;
+      const double de1dx = e1 * a - g / sqrt2s;
+      const double de2dx = -e2 * b + g / sqrt2s;
+      const double de1ds =
+          e1 * a * a * s - signS * g * (a - diff / s2) / M_SQRT2;
+      const double de2ds =
+          e2 * b * b * s - signS * g * (b + diff / s2) / M_SQRT2;
+
+      jacobian->set(i, 0, val * normFactor);
+      jacobian->set(i, 1, I * (dNormDa * val + normFactor * de1da));
+      jacobian->set(i, 2, I * (dNormDb * val + normFactor * de2db));
+      jacobian->set(i, 3, -I * normFactor * (de1dx + de2dx));
+      jacobian->set(i, 4, I * normFactor * (de1ds + de2ds));
+    } else {
+      for (size_t j = 0; j < 5; ++j) {
+        jacobian->set(i, j, 0.0);
+      }
+    }
+  }
 }
 
 /**
@@ -9,6 +9,7 @@
 //----------------------------------------------------------------------
 #include "MantidCurveFitting/Functions/ProductFunction.h"
 #include "MantidAPI/FunctionFactory.h"
+#include "MantidCurveFitting/Jacobian.h"
 
 namespace Mantid {
 namespace CurveFitting {
@@ -34,13 +35,54 @@ void ProductFunction::function(const API::FunctionDomain &domain,
 }
 
 /**
- * Calculate the derivatives numerically.
+ * Calculate the derivatives using the product rule: the derivative with
+ * respect to a parameter of a member function is the member's derivative
+ * multiplied by the values of all the other members. Each member is evaluated
+ * only once instead of once per parameter as in the numerical derivative.
  * @param domain :: Function domein.
  * @param jacobian :: Jacobian - stores the calculated derivatives
  */
 void ProductFunction::functionDeriv(const API::FunctionDomain &domain,
                                     API::Jacobian &jacobian) {
-  calNumericalDeriv(domain, jacobian);
+  if (getAttribute("NumDeriv").asBool()) {
+    calNumericalDeriv(domain, jacobian);
+    return;
+  }
+  const size_t nFuns = nFunctions();
+  const size_t nData = getValuesSize(domain);
+  std::vector<std::vector<double>> memberValues(nFuns);
+  API::FunctionValues tmp(domain);
+  for (size_t iFun = 0; iFun < nFuns; ++iFun) {
+    domain.reset();
+    getFunction(iFun)->function(domain, tmp);
+    memberValues[iFun] = tmp.toVector();
+  }
+
+  std::vector<double> others(nData);
+  for (size_t iFun = 0; iFun < nFuns; ++iFun) {
+    // product of all members except iFun
+    others.assign(nData, 1.0);
+    for (size_t jFun = 0; jFun < nFuns; ++jFun) {
+      if (jFun == iFun)
+        continue;
+      const auto &values = memberValues[jFun];
+      for (size_t i = 0; i < nData; ++i) {
+        others[i] *= values[i];
+      }
+    }
+
+    auto fun = getFunction(iFun);
+    const size_t nFunParams = fun->nParams();
+    Jacobian memberJacobian(nData, nFunParams);
+    domain.reset();
+    fun->functionDeriv(domain, memberJacobian);
+    const size_t offset = paramOffset(iFun);
+    for (size_t ip = 0; ip < nFunParams; ++ip) {
+      for (size_t i = 0; i < nData; ++i) {
+        jacobian.set(i, offset + ip, others[i] * memberJacobian.get(i, ip));
+      }
+    }
+  }
 }
 
 } // namespace Functions
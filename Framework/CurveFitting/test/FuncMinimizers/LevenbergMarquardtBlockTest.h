@@ -0,0 +1,262 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef CURVEFITTING_LEVENBERGMARQUARDTBLOCKTEST_H_
+#define CURVEFITTING_LEVENBERGMARQUARDTBLOCKTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/FunctionDomain1D.h"
+#include "MantidAPI/FunctionValues.h"
+#include "MantidCurveFitting/CostFunctions/CostFuncLeastSquares.h"
+#include "MantidCurveFitting/FuncMinimizers/LevenbergMarquardtBlockMinimizer.h"
+#include "MantidCurveFitting/Functions/UserFunction.h"
+
+#include "MantidAPI/IFunction1D.h"
+#include "MantidAPI/ParamFunction.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/System.h"
+#include "MantidTestHelpers/MultiDomainFunctionHelper.h"
+
+#include <algorithm>
+#include <atomic>
+
+using namespace Mantid;
+using namespace Mantid::CurveFitting;
+using namespace Mantid::CurveFitting::FuncMinimisers;
+using namespace Mantid::CurveFitting::CostFunctions;
+using namespace Mantid::CurveFitting::Functions;
+using namespace Mantid::API;
+
+/// A linear function that keeps its results in a member, like functions that
+/// cache intermediate results, and records if it is evaluated concurrently.
+class LevenbergMarquardtBlockTest_CachingLinear : public IFunction1D,
+                                                  public ParamFunction {
+public:
+  LevenbergMarquardtBlockTest_CachingLinear() {
+    declareParameter("A");
+    declareParameter("B");
+  }
+  std::string name() const override {
+    return "LevenbergMarquardtBlockTest_CachingLinear";
+  }
+  void function1D(double *out, const double *xValues,
+                  const size_t nData) const override {
+    if (m_evaluating.exchange(true)) {
+      m_concurrent = true;
+    }
+    const double a = getParameter("A");
+    const double b = getParameter("B");
+    m_cache.resize(nData);
+    for (size_t i = 0; i < nData; ++i) {
+      m_cache[i] = a + b * xValues[i];
+    }
+    std::copy(m_cache.begin(), m_cache.end(), out);
+    m_evaluating = false;
+  }
+  bool wasEvaluatedConcurrently() const { return m_concurrent; }
+
+private:
+  mutable std::atomic<bool> m_evaluating{false};
+  mutable std::atomic<bool> m_concurrent{false};
+  mutable std::vector<double> m_cache;
+};
+
+class LevenbergMarquardtBlockTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static LevenbergMarquardtBlockTest *createSuite() {
+    return new LevenbergMarquardtBlockTest();
+  }
+  static void destroySuite(LevenbergMarquardtBlockTest *suite) {
+    delete suite;
+  }
+
+  void test_Gaussian() {
+    API::FunctionDomain1D_sptr domain(
+        new API::FunctionDomain1DVector(0.0, 10.0, 20));
+    API::FunctionValues mockData(*domain);
+    UserFunction dataMaker;
+    dataMaker.setAttributeValue("Formula", "a*x+b+h*exp(-s*x^2)");
+    dataMaker.setParameter("a", 1.1);
+    dataMaker.setParameter("b", 2.2);
+    dataMaker.setParameter("h", 3.3);
+    dataMaker.setParameter("s", 0.2);
+    dataMaker.function(*domain, mockData);
+
+    API::FunctionValues_sptr values(new API::FunctionValues(*domain));
+    values->setFitDataFromCalculated(mockData);
+    values->setFitWeights(1.0);
+
+    boost::shared_ptr<UserFunction> fun = boost::make_shared<UserFunction>();
+    fun->setAttributeValue("Formula", "a*x+b+h*exp(-s*x^2)");
+    fun->setParameter("a", 1.);
+    fun->setParameter("b", 2.);
+    fun->setParameter("h", 3.);
+    fun->setParameter("s", 0.1);
+
+    boost::shared_ptr<CostFuncLeastSquares> costFun =
+        boost::make_shared<CostFuncLeastSquares>();
+    costFun->setFittingFunction(fun, domain, values);
+
+    LevenbergMarquardtBlockMinimizer s;
+    s.initialize(costFun);
+    TS_ASSERT(s.minimize());
+    TS_ASSERT_DELTA(costFun->val(), 0.0, 0.0001);
+    TS_ASSERT_DELTA(fun->getParameter("a"), 1.1, 0.001);
+    TS_ASSERT_DELTA(fun->getParameter("b"), 2.2, 0.001);
+    TS_ASSERT_DELTA(fun->getParameter("h"), 3.3, 0.001);
+    TS_ASSERT_DELTA(fun->getParameter("s"), 0.2, 0.001);
+    TS_ASSERT_EQUALS(s.getError(), "success");
+  }
+
+  void test_Multidomain_shared_members() {
+    auto domain = Mantid::TestHelpers::makeMultiDomainDomain3();
+
+    auto values = boost::make_shared<FunctionValues>(*domain);
+    const double A0 = 0, A1 = 1, A2 = 2;
+    const double B0 = 1, B1 = 2, B2 = 3;
+
+    auto &d0 = static_cast<const FunctionDomain1D &>(domain->getDomain(0));
+    for (size_t i = 0; i < d0.size(); ++i) {
+      values->setFitData(i, A0 + A1 + A2 + (B0 + B1 + B2) * d0[i]);
+    }
+
+    auto &d1 = static_cast<const FunctionDomain1D &>(domain->getDomain(1));
+    for (size_t i = 0; i < d1.size(); ++i) {
+      values->setFitData(9 + i, A0 + A1 + (B0 + B1) * d1[i]);
+    }
+
+    auto &d2 = static_cast<const FunctionDomain1D &>(domain->getDomain(2));
+    for (size_t i = 0; i < d2.size(); ++i) {
+      values->setFitData(19 + i, A0 + A2 + (B0 + B2) * d2[i]);
+    }
+    values->setFitWeights(1);
+
+    auto multi = Mantid::TestHelpers::makeMultiDomainFunction3();
+
+    boost::shared_ptr<CostFuncLeastSquares> costFun =
+        boost::make_shared<CostFuncLeastSquares>();
+    costFun->setFittingFunction(multi, domain, values);
+    TS_ASSERT_EQUALS(costFun->nParams(), 6);
+
+    LevenbergMarquardtBlockMinimizer s;
+    s.initialize(costFun);
+    TS_ASSERT(s.minimize());
+
+    TS_ASSERT_EQUALS(s.getError(), "success");
+    TS_ASSERT_DELTA(s.costFunctionVal(), 0, 1e-4);
+
+    TS_ASSERT_DELTA(multi->getFunction(0)->getParameter("A"), 0, 1e-6);
+    TS_ASSERT_DELTA(multi->getFunction(0)->getParameter("B"), 1, 1e-6);
+    TS_ASSERT_DELTA(multi->getFunction(1)->getParameter("A"), 1, 1e-6);
+    TS_ASSERT_DELTA(multi->getFunction(1)->getParameter("B"), 2, 1e-6);
+    TS_ASSERT_DELTA(multi->getFunction(2)->getParameter("A"), 2, 1e-6);
+    TS_ASSERT_DELTA(multi->getFunction(2)->getParameter("B"), 3, 1e-6);
+  }
+
+  void test_Multidomain_local_and_tied_parameters() {
+    auto domain = Mantid::TestHelpers::makeMultiDomainDomain3();
+
+    // Each domain has its own background and all share the slope
+    auto values = boost::make_shared<FunctionValues>(*domain);
+    const double A[] = {1, -2, 3};
+    const double B = 2;
+    size_t offset = 0;
+    for (size_t i = 0; i < 3; ++i) {
+      auto &d = static_cast<const FunctionDomain1D &>(domain->getDomain(i));
+      for (size_t j = 0; j < d.size(); ++j) {
+        values->setFitData(offset + j, A[i] + B * d[j]);
+      }
+      offset += d.size();
+    }
+    values->setFitWeights(1);
+
+    auto multi = Mantid::TestHelpers::makeMultiDomainFunction3();
+    multi->clearDomainIndices();
+    multi->setDomainIndex(0, 0);
+    multi->setDomainIndex(1, 1);
+    multi->setDomainIndex(2, 2);
+    multi->tie("f1.B", "f0.B");
+    multi->tie("f2.B", "f0.B");
+
+    boost::shared_ptr<CostFuncLeastSquares> costFun =
+        boost::make_shared<CostFuncLeastSquares>();
+    costFun->setFittingFunction(multi, domain, values);
+    TS_ASSERT_EQUALS(costFun->nParams(), 4);
+
+    LevenbergMarquardtBlockMinimizer s;
+    s.initialize(costFun);
+    TS_ASSERT(s.minimize());
+
+    TS_ASSERT_EQUALS(s.getError(), "success");
+    TS_ASSERT_DELTA(s.costFunctionVal(), 0, 1e-4);
+
+    for (size_t i = 0; i < 3; ++i) {
+      TS_ASSERT_DELTA(multi->getFunction(i)->getParameter("A"), A[i], 1e-6);
+      TS_ASSERT_DELTA(multi->getFunction(i)->getParameter("B"), B, 1e-6);
+    }
+  }
+
+  void test_Multidomain_shared_member_with_cache() {
+    auto domain = Mantid::TestHelpers::makeMultiDomainDomain3();
+
+    // A line shared by all domains plus a local quadratic term on each
+    const double A = 1, B = 2;
+    const double C[] = {1, -1, 0.5};
+    auto values = boost::make_shared<FunctionValues>(*domain);
+    size_t offset = 0;
+    for (size_t i = 0; i < 3; ++i) {
+      auto &d = static_cast<const FunctionDomain1D &>(domain->getDomain(i));
+      for (size_t j = 0; j < d.size(); ++j) {
+        values->setFitData(offset + j, A + B * d[j] + C[i] * d[j] * d[j]);
+      }
+      offset += d.size();
+    }
+    values->setFitWeights(1);
+
+    auto line = boost::make_shared<LevenbergMarquardtBlockTest_CachingLinear>();
+    auto multi = boost::make_shared<MultiDomainFunction>();
+    multi->addFunction(line);
+    for (size_t i = 0; i < 3; ++i) {
+      auto quadratic = boost::make_shared<UserFunction>();
+      quadratic->setAttributeValue("Formula", "c*x^2");
+      multi->addFunction(quadratic);
+    }
+    multi->clearDomainIndices();
+    multi->setDomainIndices(0, {0, 1, 2});
+    for (size_t i = 0; i < 3; ++i) {
+      multi->setDomainIndex(i + 1, i);
+    }
+
+    boost::shared_ptr<CostFuncLeastSquares> costFun =
+        boost::make_shared<CostFuncLeastSquares>();
+    costFun->setFittingFunction(multi, domain, values);
+    TS_ASSERT_EQUALS(costFun->nParams(), 5);
+
+    // Make sure the blocks can run concurrently
+    const int threads = PARALLEL_GET_MAX_THREADS;
+    UNUSED_ARG(threads)
+    PARALLEL_SET_NUM_THREADS(std::max(threads, 4))
+    LevenbergMarquardtBlockMinimizer s;
+    s.initialize(costFun);
+    TS_ASSERT(s.minimize());
+    PARALLEL_SET_NUM_THREADS(threads)
+
+    TS_ASSERT_EQUALS(s.getError(), "success");
+    TS_ASSERT_DELTA(s.costFunctionVal(), 0, 1e-4);
+    TS_ASSERT(!line->wasEvaluatedConcurrently());
+    TS_ASSERT_DELTA(line->getParameter("A"), A, 1e-6);
+    TS_ASSERT_DELTA(line->getParameter("B"), B, 1e-6);
+    for (size_t i = 0; i < 3; ++i) {
+      TS_ASSERT_DELTA(multi->getFunction(i + 1)->getParameter("c"), C[i],
+                      1e-6);
+    }
+  }
+};
+
+#endif /*CURVEFITTING_LEVENBERGMARQUARDTBLOCKTEST_H_*/
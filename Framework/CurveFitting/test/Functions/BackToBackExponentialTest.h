@@ -12,6 +12,7 @@
 #include "MantidAPI/FunctionDomain1D.h"
 #include "MantidAPI/FunctionValues.h"
 #include "MantidCurveFitting/Functions/BackToBackExponential.h"
+#include "MantidCurveFitting/Jacobian.h"
 
 #include <cmath>
 
@@ -191,6 +192,36 @@ public:
     TS_ASSERT_EQUALS(b2bExp.intensity(), 3.0);
     TS_ASSERT_EQUALS(b2bExp.getParameter("I"), 3.0);
   }
+
+  void test_analytical_derivatives_match_numerical() {
+    checkDerivativesMatchNumerical(1.7);
+  }
+
+  void test_analytical_derivatives_match_numerical_for_negative_sigma() {
+    checkDerivativesMatchNumerical(-1.7);
+  }
+
+private:
+  void checkDerivativesMatchNumerical(const double sigma) {
+    BackToBackExponential b2bExp;
+    b2bExp.initialize();
+    b2bExp.setParameter("I", 3.1);
+    b2bExp.setParameter("A", 1.3);
+    b2bExp.setParameter("B", 0.07);
+    b2bExp.setParameter("X0", 0.4);
+    b2bExp.setParameter("S", sigma);
+
+    Mantid::API::FunctionDomain1DVector x(-10, 20, 31);
+    Mantid::CurveFitting::Jacobian analytical(x.size(), 5);
+    Mantid::CurveFitting::Jacobian numerical(x.size(), 5);
+    b2bExp.functionDeriv(x, analytical);
+    b2bExp.calNumericalDeriv(x, numerical);
+    for (size_t i = 0; i < x.size(); ++i) {
+      for (size_t j = 0; j < 5; ++j) {
+        TS_ASSERT_DELTA(analytical.get(i, j), numerical.get(i, j), 1e-3);
+      }
+    }
+  }
 };
 
 #endif /*BACKTOBACKEXPONENTIALTEST_H_*/
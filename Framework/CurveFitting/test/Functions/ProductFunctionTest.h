@@ -265,6 +265,37 @@ public:
     TS_ASSERT_DELTA(jacobian.get(0, 3), 21, 1e-9);
   }
 
+  void testAnalyticalDerivativesMatchNumerical() {
+    ProductFunction prodF;
+
+    Mantid::API::IFunction_sptr gauss(new Gaussian);
+    gauss->initialize();
+    gauss->setParameter("PeakCentre", 1.5);
+    gauss->setParameter("Height", 2.0);
+    gauss->setParameter("Sigma", 0.8);
+
+    Mantid::API::IFunction_sptr linear(new ProductFunctionMWTest_Linear);
+    linear->setParameter(0, 0.5);
+    linear->setParameter(1, 0.3);
+
+    prodF.addFunction(gauss);
+    prodF.addFunction(linear);
+
+    Mantid::API::FunctionDomain1DVector x(0.0, 3.0, 31);
+    const size_t nParams = prodF.nParams();
+    Mantid::CurveFitting::Jacobian analytical(x.size(), nParams);
+    Mantid::CurveFitting::Jacobian numerical(x.size(), nParams);
+    prodF.functionDeriv(x, analytical);
+    prodF.calNumericalDeriv(x, numerical);
+    // The numerical derivatives are forward differences with a relative step
+    // of 1e-3, so they are off by about 2e-3 for PeakCentre here
+    for (size_t i = 0; i < x.size(); ++i) {
+      for (size_t j = 0; j < nParams; ++j) {
+        TS_ASSERT_DELTA(analytical.get(i, j), numerical.get(i, j), 5e-3);
+      }
+    }
+  }
+
 private:
 };
 
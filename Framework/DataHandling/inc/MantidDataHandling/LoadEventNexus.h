@@ -170,6 +170,13 @@ public:
 
   /// Tolerance for CompressEvents; use -1 to mean don't compress.
   double compressTolerance;
+  /// Whether compressTolerance is a fraction of the time-of-flight
+  bool compressLogarithmic;
+  /// Wall-clock tolerance in seconds for compressing; EMPTY_DBL to drop the
+  /// pulse times
+  double compressWallClockTolerance;
+  /// Start time for the wall-clock tolerance
+  Mantid::Types::Core::DateAndTime compressStartTime;
 
   /// Pulse times for ALL banks, taken from proton_charge log.
   boost::shared_ptr<BankPulseTimes> m_allBanksPulseTimes;
@@ -64,10 +64,12 @@ private:
   void loadLogs(::NeXus::File &file, const std::string &entry_name,
                 const std::string &entry_class,
                 boost::shared_ptr<API::MatrixWorkspace> workspace) const;
-  /// Load an NXlog entry
-  void loadNXLog(::NeXus::File &file, const std::string &entry_name,
+  /// The arrays of a time series log, read but not yet converted
+  struct LogData;
+  /// Read an NXlog entry
+  void readNXLog(::NeXus::File &file, const std::string &entry_name,
                  const std::string &entry_class,
-                 boost::shared_ptr<API::MatrixWorkspace> workspace) const;
+                 std::vector<LogData> &logs) const;
   /// Load an IXseblock entry
   void loadSELog(::NeXus::File &file, const std::string &entry_name,
                  boost::shared_ptr<API::MatrixWorkspace> workspace) const;
@@ -79,6 +81,11 @@ private:
   /// Create a time series property
   Kernel::Property *createTimeSeries(::NeXus::File &file,
                                      const std::string &prop_name) const;
+  /// Read the arrays of a time series log
+  LogData readTimeSeries(::NeXus::File &file,
+                         const std::string &prop_name) const;
+  /// Create a time series property from the arrays read
+  Kernel::Property *createTimeSeries(LogData &log) const;
 
   /// Progress reporting object
   boost::shared_ptr<API::Progress> m_progress;
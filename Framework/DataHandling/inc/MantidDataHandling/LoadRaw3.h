@@ -66,23 +66,26 @@ private:
                               const int64_t monitorwsSpecs);
 
   /// creates output workspace, monitors excluded from this workspace
-  void excludeMonitors(FILE *file, const int &period,
+  void excludeMonitors(const int &period,
                        const std::vector<specnum_t> &monitorList,
                        DataObjects::Workspace2D_sptr ws_sptr);
 
   /// creates output workspace whcih includes monitors
-  void includeMonitors(FILE *file, const int64_t &period,
+  void includeMonitors(const int64_t &period,
                        DataObjects::Workspace2D_sptr ws_sptr);
 
   /// creates two output workspaces none normal workspace and separate one for
   /// monitors
-  void separateMonitors(FILE *file, const int64_t &period,
+  void separateMonitors(const int64_t &period,
                         const std::vector<specnum_t> &monitorList,
                         DataObjects::Workspace2D_sptr ws_sptr,
                         DataObjects::Workspace2D_sptr mws_sptr);
 
-  /// skip all spectra in a period
-  void skipPeriod(FILE *file, const int64_t &period);
+  /// decode the given spectra of a period into a workspace
+  void readSpectra(const int64_t period, const std::vector<specnum_t> &spectra,
+                   const DataObjects::Workspace2D_sptr &ws_sptr);
+  /// check if a spectrum should be loaded
+  bool isSpectrumSelected(specnum_t spectrumNum) const;
   /// return true if loading a selection of periods
   bool isSelectedPeriods() const { return !m_periodList.empty(); }
   /// check if a period should be loaded
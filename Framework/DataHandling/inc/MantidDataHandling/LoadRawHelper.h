@@ -162,6 +162,11 @@ protected:
           &timeChannelsVec,
       int64_t wsIndex, specnum_t nspecNum, int64_t noTimeRegimes,
       int64_t lengthIn, int64_t binStart);
+  /// The time channels that a spectrum is binned with
+  const boost::shared_ptr<HistogramData::HistogramX> &spectrumTimeChannels(
+      const std::vector<boost::shared_ptr<HistogramData::HistogramX>>
+          &timeChannelsVec,
+      specnum_t nspecNum, int64_t noTimeRegimes) const;
 
   /// get proton charge from raw file
   float getProtonCharge() const;
@@ -14,6 +14,9 @@
 
 #include <boost/shared_array.hpp>
 
+#include <cstdint>
+#include <vector>
+
 namespace Mantid {
 namespace API {
 class Progress;
@@ -56,6 +59,9 @@ public:
 
 private:
   size_t getWorkspaceIndexFromPixelID(const detid_t pixID);
+  void compressEvents(std::vector<uint32_t> eventSlots,
+                      const std::vector<int64_t> &eventPulseTimes,
+                      const size_t numPixels);
 
   /// Algorithm being run
   DefaultEventLoader &m_loader;
@@ -68,7 +68,9 @@ bool exists(::NeXus::File &file, const std::string &name) {
 LoadEventNexus::LoadEventNexus()
     : filter_tof_min(0), filter_tof_max(0), m_specMin(0), m_specMax(0),
       longest_tof(0), shortest_tof(0), bad_tofs(0), discarded_events(0),
-      compressTolerance(0), m_instrument_loaded_correctly(false),
+      compressTolerance(0), compressLogarithmic(false),
+      compressWallClockTolerance(EMPTY_DBL()),
+      m_instrument_loaded_correctly(false),
       loadlogs(false), event_id_is_spec(false) {}
 
 //----------------------------------------------------------------------------------------------
@@ -177,6 +179,25 @@ void LoadEventNexus::init() {
                   "This specified the tolerance to use (in microseconds) when "
                   "compressing.");
 
+  declareProperty("CompressBinningMode", "Linear",
+                  boost::make_shared<Kernel::StringListValidator>(
+                      std::vector<std::string>{"Linear", "Logarithmic"}),
+                  "How CompressTolerance is applied while loading. Linear "
+                  "combines events within CompressTolerance microseconds of "
+                  "each other; Logarithmic combines events whose "
+                  "times-of-flight differ by less than the fraction "
+                  "CompressTolerance of their time-of-flight.");
+
+  auto mustBeNonNegative = boost::make_shared<BoundedValidator<double>>();
+  mustBeNonNegative->setLower(0.0);
+  declareProperty("CompressWallClockTolerance", EMPTY_DBL(),
+                  mustBeNonNegative,
+                  "The tolerance (in seconds) on the wall-clock time for "
+                  "compressing events while loading. Events are only combined "
+                  "if their pulse times are also within this tolerance. The "
+                  "default is to not keep pulse times. Only used with "
+                  "CompressTolerance.");
+
   auto mustBePositive = boost::make_shared<BoundedValidator<int>>();
   mustBePositive->setLower(1);
   declareProperty("ChunkNumber", EMPTY_INT(), mustBePositive,
@@ -194,6 +215,8 @@ void LoadEventNexus::init() {
   std::string grp3 = "Reduce Memory Use";
   setPropertyGroup("Precount", grp3);
   setPropertyGroup("CompressTolerance", grp3);
+  setPropertyGroup("CompressBinningMode", grp3);
+  setPropertyGroup("CompressWallClockTolerance", grp3);
   setPropertyGroup("ChunkNumber", grp3);
   setPropertyGroup("TotalChunks", grp3);
 
@@ -364,6 +387,17 @@ void LoadEventNexus::exec() {
   m_filename = getPropertyValue("Filename");
 
   compressTolerance = getProperty("CompressTolerance");
+  compressLogarithmic =
+      getPropertyValue("CompressBinningMode") == "Logarithmic";
+  compressWallClockTolerance = getProperty("CompressWallClockTolerance");
+  if (compressTolerance >= 0 && compressLogarithmic) {
+    if (compressTolerance == 0)
+      throw std::invalid_argument(
+          "CompressTolerance must be positive for logarithmic compression");
+    if (!isEmpty(compressWallClockTolerance))
+      throw std::invalid_argument("CompressWallClockTolerance cannot be used "
+                                  "with logarithmic compression");
+  }
 
   loadlogs = getProperty("LoadLogs");
 
@@ -873,6 +907,9 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
   filter_time_start = Types::Core::DateAndTime::minimum();
   filter_time_stop = Types::Core::DateAndTime::maximum();
 
+  // Wall-clock compression is relative to the start of the run
+  compressStartTime = run_start;
+
   if (m_allBanksPulseTimes->numPulses > 0) {
     // If not specified, use the limits of doubles. Otherwise, convert from
     // seconds to absolute PulseTime
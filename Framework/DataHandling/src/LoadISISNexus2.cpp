@@ -24,6 +24,7 @@
 #include "MantidKernel/ListValidator.h"
 //#include "MantidKernel/LogParser.h"
 #include "MantidKernel/LogFilter.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidKernel/UnitFactory.h"
 
@@ -46,6 +47,11 @@
 #include <vector>
 
 namespace {
+/// The largest number of counts read from the file in one go. Reading many
+/// spectra at once keeps the number of calls into the NeXus API low and
+/// gives the threads converting the counts enough work.
+constexpr int64_t MAX_BLOCK_BUFFER_SIZE = 1 << 22;
+
 Mantid::DataHandling::DataBlockComposite
 getMonitorsFromComposite(Mantid::DataHandling::DataBlockComposite &composite,
                          Mantid::DataHandling::DataBlockComposite &monitors) {
@@ -831,7 +837,9 @@ void LoadISISNexus2::loadPeriodData(
       // When reading in blocks we need to be careful that the range is exactly
       // divisible by the block-size
       // and if not have an extra read of the left overs
-      const int64_t blocksize = 8;
+      const int64_t blocksize = std::max<int64_t>(
+          1, MAX_BLOCK_BUFFER_SIZE /
+                 static_cast<int64_t>(m_detBlockInfo.getNumberOfChannels()));
       const int64_t rangesize = spectraBlock.last - spectraBlock.first + 1;
       const int64_t fullblocks = rangesize / blocksize;
       int64_t spectra_no = spectraBlock.first;
@@ -879,7 +887,8 @@ void LoadISISNexus2::createPeriodLogs(
 
 /**
  * Perform a call to nxgetslab, via the NexusClasses wrapped methods for a given
- * block-size
+ * block-size. The file is read by a single thread, as the NeXus API is not
+ * thread safe, while the counts are converted into histograms in parallel.
  * @param data :: The NXDataSet object
  * @param blocksize :: The block-size to use
  * @param period :: The period number
@@ -894,15 +903,25 @@ void LoadISISNexus2::loadBlock(NXDataSetTyped<int> &data, int64_t blocksize,
                                DataObjects::Workspace2D_sptr &local_workspace) {
   data.load(static_cast<int>(blocksize), static_cast<int>(period),
             static_cast<int>(start)); // TODO this is just wrong
-  int *data_start = data();
-  int *data_end = data_start + m_loadBlockInfo.getNumberOfChannels();
+  const int *const buffer = data();
+  const auto nChannels =
+      static_cast<int64_t>(m_loadBlockInfo.getNumberOfChannels());
+  const auto stride =
+      static_cast<int64_t>(m_detBlockInfo.getNumberOfChannels());
+  // All spectra of all periods share the same time-of-flight axis
+  const BinEdges tof(m_tof_data);
+  const int64_t first(hist);
+
+  PARALLEL_FOR_IF(Kernel::threadSafe(*local_workspace))
+  for (int64_t i = 0; i < blocksize; ++i) {
+    const int *const data_start = buffer + i * stride;
+    local_workspace->setHistogram(first + i, tof,
+                                  Counts(data_start, data_start + nChannels));
+  }
+  m_progress->reportIncrement(static_cast<size_t>(blocksize), "Loading data");
+
   int64_t final(hist + blocksize);
   while (hist < final) {
-    m_progress->report("Loading data");
-    local_workspace->setHistogram(hist, BinEdges(m_tof_data),
-                                  Counts(data_start, data_end));
-    data_start += m_detBlockInfo.getNumberOfChannels();
-    data_end += m_detBlockInfo.getNumberOfChannels();
     if (m_load_selected_spectra) {
       // local_workspace->getAxis(1)->setValue(hist,
       // static_cast<specnum_t>(spec_num));
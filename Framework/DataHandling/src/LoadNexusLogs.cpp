@@ -8,6 +8,7 @@
 #include "MantidAPI/FileProperty.h"
 #include "MantidAPI/Run.h"
 #include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include <locale>
 #include <nexus/NeXusException.hpp>
@@ -21,6 +22,7 @@
 #include <boost/scoped_array.hpp>
 
 #include <algorithm>
+#include <memory>
 
 namespace Mantid {
 namespace DataHandling {
@@ -35,6 +37,22 @@ using API::WorkspaceProperty;
 using Types::Core::DateAndTime;
 using std::size_t;
 
+/// The arrays of a time series log. Reading must be serial but converting
+/// them into a TimeSeriesProperty is independent for each log.
+struct LoadNexusLogs::LogData {
+  enum class ValueType { Int, Double, String };
+  std::string name;
+  DateAndTime start;
+  std::vector<double> times;
+  std::string units;
+  ValueType type{ValueType::Double};
+  std::vector<int> intValues;
+  std::vector<double> doubleValues;
+  /// String values are stored one after another, itemLength characters each
+  std::string stringValues;
+  size_t itemLength{0};
+};
+
 // Anonymous namespace
 namespace {
 /**
@@ -207,6 +225,10 @@ void LoadNexusLogs::init() {
   declareProperty(std::make_unique<PropertyWithValue<std::string>>(
                       "NXentryName", "", Direction::Input),
                   "Entry in the nexus file from which to read the logs");
+  declareProperty(std::make_unique<ArrayProperty<std::string>>("AllowList"),
+                  "If set, only the NXlog entries with these names are "
+                  "loaded. Other logs such as the run title and proton "
+                  "charge are unaffected.");
 }
 
 /** Executes the algorithm. Reading in the file and creating and populating
@@ -500,34 +522,73 @@ void LoadNexusLogs::loadLogs(
     const std::string &entry_class,
     boost::shared_ptr<API::MatrixWorkspace> workspace) const {
   file.openGroup(entry_name, entry_class);
+  // whether or not to overwrite logs on workspace
+  const bool overwritelogs = this->getProperty("OverwriteLogs");
+  const std::vector<std::string> allowList = this->getProperty("AllowList");
+  auto isAllowed = [&allowList](const std::string &name) {
+    return allowList.empty() || std::find(allowList.cbegin(), allowList.cend(),
+                                          name) != allowList.cend();
+  };
+
+  // The file can only be read by one thread, so read the arrays of all the
+  // NXlog entries first and convert them to properties in parallel after
+  std::vector<LogData> logs;
   std::map<std::string, std::string> entries = file.getEntries();
   std::map<std::string, std::string>::const_iterator iend = entries.end();
   for (std::map<std::string, std::string>::const_iterator itr = entries.begin();
        itr != iend; ++itr) {
     std::string log_class = itr->second;
     if (log_class == "NXlog" || log_class == "NXpositioner") {
-      loadNXLog(file, itr->first, log_class, workspace);
+      if (isAllowed(itr->first) &&
+          (overwritelogs || !workspace->run().hasProperty(itr->first)))
+        readNXLog(file, itr->first, log_class, logs);
     } else if (log_class == "IXseblock") {
       loadSELog(file, itr->first, workspace);
     }
   }
+
+  // Exceptions must not escape the parallel loop, so a log that cannot be
+  // converted is skipped with a warning like one that cannot be read
+  std::vector<std::unique_ptr<Kernel::Property>> properties(logs.size());
+  std::vector<std::string> errors(logs.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < static_cast<int>(logs.size()); ++i) {
+    try {
+      properties[i].reset(createTimeSeries(logs[i]));
+    } catch (std::exception &e) {
+      errors[i] = e.what();
+    }
+  }
+  for (size_t i = 0; i < logs.size(); ++i) {
+    if (!errors[i].empty()) {
+      g_log.warning() << "NXlog entry " << logs[i].name
+                      << " gave an error when loading:'" << errors[i]
+                      << "'.\n";
+    }
+  }
+  for (auto &property : properties) {
+    if (!property)
+      continue;
+    appendEndTimeLog(property.get(), workspace->run());
+    workspace->mutableRun().addProperty(property.release(), overwritelogs);
+  }
   loadVetoPulses(file, workspace);
 
   file.closeGroup();
 }
 
 /**
- * Load an NX log entry a group type that has value and time entries.
+ * Read an NX log entry a group type that has value and time entries.
  * @param file :: A reference to the NeXus file handle opened at the parent
  * group
  * @param entry_name :: The name of the log entry
  * @param entry_class :: The type of the entry
- * @param workspace :: A pointer to the workspace to store the logs
+ * @param logs :: The log is appended to these if it can be read
  */
-void LoadNexusLogs::loadNXLog(
-    ::NeXus::File &file, const std::string &entry_name,
-    const std::string &entry_class,
-    boost::shared_ptr<API::MatrixWorkspace> workspace) const {
+void LoadNexusLogs::readNXLog(::NeXus::File &file,
+                              const std::string &entry_name,
+                              const std::string &entry_class,
+                              std::vector<LogData> &logs) const {
   g_log.debug() << "processing " << entry_name << ":" << entry_class << "\n";
 
   file.openGroup(entry_name, entry_class);
@@ -540,14 +601,8 @@ void LoadNexusLogs::loadNXLog(
     file.closeGroup();
     return;
   }
-  // whether or not to overwrite logs on workspace
-  bool overwritelogs = this->getProperty("OverwriteLogs");
   try {
-    if (overwritelogs || !(workspace->run().hasProperty(entry_name))) {
-      Kernel::Property *logValue = createTimeSeries(file, entry_name);
-      appendEndTimeLog(logValue, workspace->run());
-      workspace->mutableRun().addProperty(logValue, overwritelogs);
-    }
+    logs.emplace_back(readTimeSeries(file, entry_name));
   } catch (::NeXus::Exception &e) {
     g_log.warning() << "NXlog entry " << entry_name
                     << " gave an error when loading:'" << e.what() << "'.\n";
@@ -645,6 +700,22 @@ void LoadNexusLogs::loadSELog(
 Kernel::Property *
 LoadNexusLogs::createTimeSeries(::NeXus::File &file,
                                 const std::string &prop_name) const {
+  auto log = readTimeSeries(file, prop_name);
+  return createTimeSeries(log);
+}
+
+/**
+ * Reads the time and value arrays of the currently opened log entry. It is
+ * assumed to have been checked to have a time field.
+ * @param file :: A reference to the file handle
+ * @param prop_name :: The name of the property
+ * @returns The arrays of the log
+ */
+LoadNexusLogs::LogData
+LoadNexusLogs::readTimeSeries(::NeXus::File &file,
+                              const std::string &prop_name) const {
+  LogData log;
+  log.name = prop_name;
   file.openData("time");
   //----- Start time is an ISO8601 string date and time. ------
   std::string start;
@@ -665,7 +736,7 @@ LoadNexusLogs::createTimeSeries(::NeXus::File &file,
   }
 
   // Convert to date and time
-  Types::Core::DateAndTime start_time = Types::Core::DateAndTime(start);
+  log.start = Types::Core::DateAndTime(start);
   std::string time_units;
   file.getAttr("units", time_units);
   if (time_units.compare("second") < 0 && time_units != "s" &&
@@ -675,7 +746,7 @@ LoadNexusLogs::createTimeSeries(::NeXus::File &file,
     throw ::NeXus::Exception("Unsupported time unit '" + time_units + "'");
   }
   //--- Load the seconds into a double array ---
-  std::vector<double> time_double;
+  std::vector<double> &time_double = log.times;
   try {
     file.getDataCoerce(time_double);
   } catch (::NeXus::Exception &e) {
@@ -695,12 +766,11 @@ LoadNexusLogs::createTimeSeries(::NeXus::File &file,
   // Now the values: Could be a string, int or double
   file.openData("value");
   // Get the units of the property
-  std::string value_units;
   try {
-    file.getAttr("units", value_units);
+    file.getAttr("units", log.units);
   } catch (::NeXus::Exception &) {
     // Ignore missing units field.
-    value_units = "";
+    log.units = "";
   }
 
   // Now the actual data
@@ -712,22 +782,16 @@ LoadNexusLogs::createTimeSeries(::NeXus::File &file,
   }
   if (file.isDataInt()) // Int type
   {
-    std::vector<int> values;
+    log.type = LogData::ValueType::Int;
     try {
-      file.getDataCoerce(values);
+      file.getDataCoerce(log.intValues);
       file.closeData();
     } catch (::NeXus::Exception &) {
       file.closeData();
       throw;
     }
-    // Make an int TSP
-    auto tsp = new TimeSeriesProperty<int>(prop_name);
-    tsp->create(start_time, time_double, values);
-    tsp->setUnits(value_units);
-    g_log.debug() << "   done reading \"value\" array\n";
-    return tsp;
   } else if (info.type == ::NeXus::CHAR) {
-    std::string values;
+    log.type = LogData::ValueType::String;
     const int64_t item_length = info.dims[1];
     try {
       const int64_t nitems = info.dims[0];
@@ -735,48 +799,71 @@ LoadNexusLogs::createTimeSeries(::NeXus::File &file,
       boost::scoped_array<char> val_array(new char[total_length]);
       file.getData(val_array.get());
       file.closeData();
-      values = std::string(val_array.get(), total_length);
+      log.stringValues = std::string(val_array.get(), total_length);
     } catch (::NeXus::Exception &) {
       file.closeData();
       throw;
     }
-    // The string may contain non-printable (i.e. control) characters, replace
-    // these
-    std::replace_if(
-        values.begin(), values.end(),
-        [&](const char &c) { return isControlValue(c, prop_name, g_log); },
-        ' ');
-    auto tsp = new TimeSeriesProperty<std::string>(prop_name);
-    std::vector<DateAndTime> times;
-    DateAndTime::createVector(start_time, time_double, times);
-    const size_t ntimes = times.size();
-    for (size_t i = 0; i < ntimes; ++i) {
-      std::string value_i =
-          std::string(values.data() + i * item_length, item_length);
-      tsp->addValue(times[i], value_i);
-    }
-    tsp->setUnits(value_units);
-    g_log.debug() << "   done reading \"value\" array\n";
-    return tsp;
+    log.itemLength = static_cast<size_t>(item_length);
   } else if (info.type == ::NeXus::FLOAT32 || info.type == ::NeXus::FLOAT64) {
-    std::vector<double> values;
+    log.type = LogData::ValueType::Double;
     try {
-      file.getDataCoerce(values);
+      file.getDataCoerce(log.doubleValues);
       file.closeData();
     } catch (::NeXus::Exception &) {
       file.closeData();
       throw;
     }
-    auto tsp = new TimeSeriesProperty<double>(prop_name);
-    tsp->create(start_time, time_double, values);
-    tsp->setUnits(value_units);
-    g_log.debug() << "   done reading \"value\" array\n";
-    return tsp;
   } else {
     throw ::NeXus::Exception(
         "Invalid value type for time series. Only int, double or strings are "
         "supported");
   }
+  g_log.debug() << "   done reading \"value\" array\n";
+  return log;
+}
+
+/**
+ * Creates a time series property from the arrays of a log. This does not
+ * touch the file, so it may be called for several logs at once.
+ * @param log :: The arrays read from the file. The values are moved out.
+ * @returns A pointer to a new property containing the time series
+ */
+Kernel::Property *LoadNexusLogs::createTimeSeries(LogData &log) const {
+  switch (log.type) {
+  case LogData::ValueType::Int: {
+    // Make an int TSP
+    auto tsp = new TimeSeriesProperty<int>(log.name);
+    tsp->create(log.start, log.times, log.intValues);
+    tsp->setUnits(log.units);
+    return tsp;
+  }
+  case LogData::ValueType::String: {
+    // The string may contain non-printable (i.e. control) characters, replace
+    // these
+    auto &values = log.stringValues;
+    std::replace_if(
+        values.begin(), values.end(),
+        [&](const char &c) { return isControlValue(c, log.name, g_log); },
+        ' ');
+    std::vector<DateAndTime> times;
+    DateAndTime::createVector(log.start, log.times, times);
+    std::vector<std::string> items(times.size());
+    for (size_t i = 0; i < items.size(); ++i) {
+      items[i].assign(values.data() + i * log.itemLength, log.itemLength);
+    }
+    auto tsp = new TimeSeriesProperty<std::string>(log.name);
+    tsp->create(times, items);
+    tsp->setUnits(log.units);
+    return tsp;
+  }
+  default: {
+    auto tsp = new TimeSeriesProperty<double>(log.name);
+    tsp->create(log.start, log.times, log.doubleValues);
+    tsp->setUnits(log.units);
+    return tsp;
+  }
+  }
 }
 
 } // namespace DataHandling
@@ -8,9 +8,12 @@
 #include "byte_rel_comp.h"
 #include <cstdio>
 #include <exception>
+#include <stdexcept>
 
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Logger.h"
+#include <Poco/File.h>
+#include <Poco/SharedMemory.h>
 #include <boost/lexical_cast.hpp>
 
 namespace {
@@ -166,6 +169,53 @@ bool ISISRAW2::readData(FILE *file, int i) {
   return true;
 }
 
+/** Map the file into memory so that spectra can be decoded with
+ * readMappedData. Only the pages holding the spectra that are read are
+ * loaded from disk. The headers must have been read with ioRAW first.
+ * @param filename :: The path to the file that the headers were read from
+ * @throw std::runtime_error if the file is shorter than its data section
+ */
+void ISISRAW2::mapData(const std::string &filename) {
+  const Poco::File file(filename);
+  m_mappedFile = std::make_unique<Poco::SharedMemory>(
+      file, Poco::SharedMemory::AM_READ);
+
+  // The data section starts with a version word, the data header and the
+  // spectrum descriptors, which are followed by the compressed spectra
+  m_spectrumOffsets.resize(ndes + 1);
+  m_spectrumOffsets[0] =
+      4 * (static_cast<int64_t>(add.ad_data) + 32 + 2 * ndes);
+  for (int i = 0; i < ndes; ++i) {
+    m_spectrumOffsets[i + 1] =
+        m_spectrumOffsets[i] + 4 * static_cast<int64_t>(ddes[i].nwords);
+  }
+  const auto fileSize = static_cast<int64_t>(file.getSize());
+  if (m_spectrumOffsets.back() > fileSize) {
+    m_mappedFile.reset();
+    throw std::runtime_error("The data section of the RAW file " + filename +
+                             " is truncated");
+  }
+}
+
+/** Decode a spectrum from the mapped file. As no state is shared between
+ * calls this can be called from several threads at once.
+ * @param i :: The index of the spectrum in the file
+ * @param counts :: Output for the t_ntc1 + 1 counts of the spectrum
+ * @return true on success
+ */
+bool ISISRAW2::readMappedData(int i, uint32_t *counts) const {
+  if (!m_mappedFile || i < 0 || i >= ndes)
+    return false;
+  const auto nbytes =
+      static_cast<int>(m_spectrumOffsets[i + 1] - m_spectrumOffsets[i]);
+  if (nbytes == 0)
+    return false;
+  // byte_rel_expn does not modify its input
+  byte_rel_expn(m_mappedFile->begin() + m_spectrumOffsets[i], nbytes, 0,
+                reinterpret_cast<int *>(counts), t_ntc1 + 1);
+  return true;
+}
+
 ISISRAW2::~ISISRAW2() {
   // fclose(m_file);
   if (outbuff)
@@ -9,6 +9,15 @@
 
 #include "isisraw.h"
 
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Poco {
+class SharedMemory;
+}
+
 /// isis raw file.
 //  isis raw
 class ISISRAW2 : public ISISRAW {
@@ -20,12 +29,19 @@ public:
 
   void skipData(FILE *file, int i);
   bool readData(FILE *file, int i);
+  void mapData(const std::string &filename);
+  bool readMappedData(int i, uint32_t *counts) const;
   void clear();
 
   int ndes; ///< ndes
 private:
   char *outbuff; ///< output buffer
   int m_bufferSize;
+  /// The file mapped into memory, if mapData has been called
+  std::unique_ptr<Poco::SharedMemory> m_mappedFile;
+  /// Byte offsets into the mapped file of each compressed spectrum, with one
+  /// extra entry marking the end of the last spectrum
+  std::vector<int64_t> m_spectrumOffsets;
 };
 
 #endif /* ISISRAW2_H */
@@ -7,6 +7,7 @@
 #include "MantidDataHandling/LoadRaw3.h"
 #include "LoadRaw/isisraw2.h"
 #include "MantidAPI/FileProperty.h"
+#include "MantidAPI/Progress.h"
 #include "MantidAPI/RegisterFileLoader.h"
 #include "MantidAPI/SpectraAxis.h"
 #include "MantidAPI/SpectrumDetectorMapping.h"
@@ -17,12 +18,15 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/UnitFactory.h"
 
 #include <Poco/Path.h>
 #include <boost/shared_ptr.hpp>
+#include <algorithm>
 #include <cmath>
 #include <cstdio> //Required for gcc 4.4
+#include <memory>
 
 namespace Mantid {
 namespace DataHandling {
@@ -107,6 +111,15 @@ void LoadRaw3::exec() {
   // read workspace dimensions,number of periods etc from the raw file.
   readworkspaceParameters(m_numberOfSpectra, m_numberOfPeriods, m_lengthIn,
                           m_noTimeRegimes);
+  // The spectra are decoded from the mapped file, so the headers are all
+  // that is read through the file handle
+  try {
+    isisRaw().mapData(m_filename);
+  } catch (std::exception &) {
+    fclose(file);
+    throw;
+  }
+  fclose(file);
 
   setOptionalProperties();
   // to validate the optional parameters, if set
@@ -169,13 +182,8 @@ void LoadRaw3::exec() {
     monitorSpecList = getmonitorSpectrumList(detectorMapping);
     // calculate the workspace size for normal workspace and monitor workspace
     calculateWorkspacesizes(monitorSpecList, normalwsSpecs, monitorwsSpecs);
-    try {
-      validateWorkspaceSizes(bexcludeMonitors, bseparateMonitors, normalwsSpecs,
-                             monitorwsSpecs);
-    } catch (std::out_of_range &) {
-      fclose(file);
-      throw;
-    }
+    validateWorkspaceSizes(bexcludeMonitors, bseparateMonitors, normalwsSpecs,
+                           monitorwsSpecs);
 
     // now create a workspace of size normalwsSpecs and set it as output
     // workspace
@@ -209,12 +217,8 @@ void LoadRaw3::exec() {
   // separate workspace
 
   for (int period = 0; period < m_numberOfPeriods; ++period) {
-    // skipping the first spectra in each period
-    skipData(file, static_cast<int>(period * (m_numberOfSpectra + 1)));
-
     // check for excluded periods
     if (!isPeriodIncluded(period)) {
-      skipPeriod(file, period);
       continue;
     }
 
@@ -260,13 +264,13 @@ void LoadRaw3::exec() {
     }
 
     if (bexcludeMonitors) {
-      excludeMonitors(file, period, monitorSpecList, localWorkspace);
+      excludeMonitors(period, monitorSpecList, localWorkspace);
     }
     if (bincludeMonitors) {
-      includeMonitors(file, period, localWorkspace);
+      includeMonitors(period, localWorkspace);
     }
     if (bseparateMonitors) {
-      separateMonitors(file, period, monitorSpecList, localWorkspace,
+      separateMonitors(period, monitorSpecList, localWorkspace,
                        monitorWorkspace);
     }
 
@@ -301,162 +305,138 @@ void LoadRaw3::exec() {
   // Clean up
 
   reset();
-  fclose(file);
 }
 /** This method creates outputworkspace excluding monitors
- *@param file :: -pointer to file
  *@param period :: period number
  *@param monitorList :: a list containing the spectrum numbers for monitors
  *@param ws_sptr :: shared pointer to workspace
  */
-void LoadRaw3::excludeMonitors(FILE *file, const int &period,
+void LoadRaw3::excludeMonitors(const int &period,
                                const std::vector<specnum_t> &monitorList,
                                DataObjects::Workspace2D_sptr ws_sptr) {
-  int64_t histCurrent = -1;
-  int64_t wsIndex = 0;
-  double histTotal = static_cast<double>(m_total_specs * m_numberOfPeriods);
+  std::vector<specnum_t> spectra;
   // loop through the spectra
   for (specnum_t i = 1; i <= m_numberOfSpectra; ++i) {
-    specnum_t histToRead = i + period * (m_numberOfSpectra + 1);
-    if ((i >= m_spec_min && i < m_spec_max) ||
-        (m_list && find(m_spec_list.begin(), m_spec_list.end(), i) !=
-                       m_spec_list.end())) {
-      progress(m_prog, "Reading raw file data...");
-      // skip monitor spectrum
-      if (isMonitor(monitorList, i)) {
-        skipData(file, histToRead);
-        continue;
-      }
-
-      // read spectrum
-      if (!readData(file, histToRead)) {
-        throw std::runtime_error("Error reading raw file");
-      }
-      // set the workspace data
-      setWorkspaceData(ws_sptr, m_timeChannelsVec, wsIndex, i, m_noTimeRegimes,
-                       m_lengthIn, 1);
-      // increment workspace index
-      ++wsIndex;
-
-      if (m_numberOfPeriods == 1) {
-        if (++histCurrent % 100 == 0) {
-          setProg(static_cast<double>(histCurrent) / histTotal);
-        }
-        interruption_point();
-      }
-
-    } // end of if loop for spec min,max check
-    else {
-      skipData(file, histToRead);
+    // skip monitor spectrum
+    if (isSpectrumSelected(i) && !isMonitor(monitorList, i)) {
+      spectra.emplace_back(i);
     }
-  } // end of for loop
+  }
+  readSpectra(period, spectra, ws_sptr);
 }
 
 /**This method creates outputworkspace including monitors
- *@param file :: -pointer to file
  *@param period :: period number
  *@param ws_sptr :: shared pointer to workspace
  */
-void LoadRaw3::includeMonitors(FILE *file, const int64_t &period,
+void LoadRaw3::includeMonitors(const int64_t &period,
                                DataObjects::Workspace2D_sptr ws_sptr) {
-
-  int64_t histCurrent = -1;
-  int64_t wsIndex = 0;
-  double histTotal = static_cast<double>(m_total_specs * m_numberOfPeriods);
+  std::vector<specnum_t> spectra;
   // loop through spectra
   for (specnum_t i = 1; i <= m_numberOfSpectra; ++i) {
-    int64_t histToRead = i + period * (m_numberOfSpectra + 1);
-    if ((i >= m_spec_min && i < m_spec_max) ||
-        (m_list && find(m_spec_list.begin(), m_spec_list.end(), i) !=
-                       m_spec_list.end())) {
-      progress(m_prog, "Reading raw file data...");
-
-      // read spectrum from raw file
-      if (!readData(file, histToRead)) {
-        throw std::runtime_error("Error reading raw file");
-      }
-      // set workspace data
-      setWorkspaceData(ws_sptr, m_timeChannelsVec, wsIndex, i, m_noTimeRegimes,
-                       m_lengthIn, 1);
-      ++wsIndex;
-
-      if (m_numberOfPeriods == 1) {
-        if (++histCurrent % 100 == 0) {
-          setProg(double(histCurrent) / histTotal);
-        }
-        interruption_point();
-      }
-
-    } else {
-      skipData(file, histToRead);
+    if (isSpectrumSelected(i)) {
+      spectra.emplace_back(i);
     }
   }
-  // loadSpectra(file,period,m_total_specs,ws_sptr,m_timeChannelsVec);
+  readSpectra(period, spectra, ws_sptr);
 }
 
 /** This method separates monitors and creates two outputworkspaces
- *@param file :: -pointer to file
  *@param period :: period number
  *@param monitorList :: -a list containing the spectrum numbers for monitors
  *@param ws_sptr :: -shared pointer to workspace
  *@param mws_sptr :: -shared pointer to monitor workspace
  */
 
-void LoadRaw3::separateMonitors(FILE *file, const int64_t &period,
+void LoadRaw3::separateMonitors(const int64_t &period,
                                 const std::vector<specnum_t> &monitorList,
                                 DataObjects::Workspace2D_sptr ws_sptr,
                                 DataObjects::Workspace2D_sptr mws_sptr) {
-  int64_t histCurrent = -1;
-  int64_t wsIndex = 0;
-  int64_t mwsIndex = 0;
-  double histTotal = static_cast<double>(m_total_specs * m_numberOfPeriods);
+  std::vector<specnum_t> spectra;
+  std::vector<specnum_t> monitorSpectra;
   // loop through spectra
   for (specnum_t i = 1; i <= m_numberOfSpectra; ++i) {
-    int64_t histToRead = i + period * (m_numberOfSpectra + 1);
-    if ((i >= m_spec_min && i < m_spec_max) ||
-        (m_list && find(m_spec_list.begin(), m_spec_list.end(), i) !=
-                       m_spec_list.end())) {
-      progress(m_prog, "Reading raw file data...");
-
-      // read spectrum from raw file
-      if (!readData(file, histToRead)) {
-        throw std::runtime_error("Error reading raw file");
-      }
-      // if this a monitor  store that spectrum to monitor workspace
-      if (isMonitor(monitorList, i)) {
-        setWorkspaceData(mws_sptr, m_timeChannelsVec, mwsIndex, i,
-                         m_noTimeRegimes, m_lengthIn, 1);
-        ++mwsIndex;
-      } else {
-        // not a monitor,store the spectrum to normal output workspace
-        setWorkspaceData(ws_sptr, m_timeChannelsVec, wsIndex, i,
-                         m_noTimeRegimes, m_lengthIn, 1);
-        ++wsIndex;
-      }
-
-      if (m_numberOfPeriods == 1) {
-        if (++histCurrent % 100 == 0) {
-          setProg(static_cast<double>(histCurrent) / histTotal);
-        }
-        interruption_point();
-      }
-
+    if (!isSpectrumSelected(i)) {
+      continue;
+    }
+    // if this a monitor  store that spectrum to monitor workspace
+    if (isMonitor(monitorList, i)) {
+      monitorSpectra.emplace_back(i);
     } else {
-      skipData(file, histToRead);
+      spectra.emplace_back(i);
     }
   }
+  readSpectra(period, monitorSpectra, mws_sptr);
+  readSpectra(period, spectra, ws_sptr);
 }
 
 /**
- * Skip all spectra in a period.
- * @param file :: -pointer to file
+ * Decode spectra of a period from the mapped file into a workspace. The
+ * spectra are decoded in parallel and only the parts of the file holding them
+ * are read from disk.
  * @param period :: period number
+ * @param spectra :: The spectrum numbers to read, in workspace index order
+ * @param ws_sptr :: The workspace to fill. Nothing is read if it is null.
+ * @throw std::runtime_error if a spectrum cannot be read
  */
-void LoadRaw3::skipPeriod(FILE *file, const int64_t &period) {
-  for (specnum_t i = 1; i <= m_numberOfSpectra; ++i) {
-    int64_t histToRead = i + period * (m_numberOfSpectra + 1);
-    skipData(file, histToRead);
+void LoadRaw3::readSpectra(const int64_t period,
+                           const std::vector<specnum_t> &spectra,
+                           const DataObjects::Workspace2D_sptr &ws_sptr) {
+  if (!ws_sptr || spectra.empty())
+    return;
+  const auto nSpectra = static_cast<int64_t>(spectra.size());
+  // The spectrum numbers are set up front as setting them is not thread safe
+  for (int64_t wsIndex = 0; wsIndex < nSpectra; ++wsIndex) {
+    ws_sptr->getSpectrum(wsIndex).setSpectrumNo(spectra[wsIndex]);
   }
+
+  // Each period gets an equal share of the progress range, split between
+  // the calls for that period by the number of spectra they read
+  const double progEnd =
+      std::min(m_prog + (m_prog_end - m_prog_start) *
+                            static_cast<double>(nSpectra) /
+                            static_cast<double>(m_total_specs) /
+                            static_cast<double>(m_numberOfPeriods),
+               m_prog_end);
+  std::unique_ptr<Progress> prog;
+  if (progEnd > m_prog) {
+    prog = std::make_unique<Progress>(this, m_prog, progEnd, nSpectra);
+  }
+
+  const auto &raw = isisRaw();
+  PARALLEL_FOR_IF(Kernel::threadSafe(*ws_sptr))
+  for (int64_t wsIndex = 0; wsIndex < nSpectra; ++wsIndex) {
+    PARALLEL_START_INTERUPT_REGION
+    const specnum_t specNum = spectra[wsIndex];
+    const auto histToRead =
+        static_cast<int>(specNum + period * (m_numberOfSpectra + 1));
+    std::vector<uint32_t> counts(m_lengthIn);
+    if (!raw.readMappedData(histToRead, counts.data())) {
+      throw std::runtime_error("Error reading raw file");
+    }
+    // The first channel is dropped but the last (overflow) bin is kept
+    auto &Y = ws_sptr->mutableY(wsIndex);
+    Y.assign(counts.cbegin() + 1, counts.cend());
+    // Fill the vector for the errors, containing sqrt(count)
+    ws_sptr->setCountVariances(wsIndex, Y.rawData());
+    ws_sptr->setX(wsIndex, spectrumTimeChannels(m_timeChannelsVec, specNum,
+                                                m_noTimeRegimes));
+    if (prog) {
+      prog->report("Reading raw file data...");
+    }
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+  m_prog = progEnd;
+}
+
+/** Check if a spectrum has been selected with the spectrum properties.
+ * @param spectrumNum :: A spectrum number
+ */
+bool LoadRaw3::isSpectrumSelected(specnum_t spectrumNum) const {
+  return (spectrumNum >= m_spec_min && spectrumNum < m_spec_max) ||
+         (m_list && std::find(m_spec_list.begin(), m_spec_list.end(),
+                              spectrumNum) != m_spec_list.end());
 }
 
 /** Check if a period should be loaded.
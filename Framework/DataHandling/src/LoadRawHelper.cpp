@@ -427,14 +427,27 @@ void LoadRawHelper::setWorkspaceData(
     return;
   }
   // Set the X vector pointer and spectrum number
-  if (noTimeRegimes < 2)
-    newWorkspace->setX(wsIndex, timeChannelsVec[0]);
-  else {
+  newWorkspace->setX(
+      wsIndex, spectrumTimeChannels(timeChannelsVec, nspecNum, noTimeRegimes));
+}
 
-    // Use std::vector::at just incase spectrum missing from spec array
-    newWorkspace->setX(wsIndex,
-                       timeChannelsVec.at(m_specTimeRegimes[nspecNum] - 1));
-  }
+/** Find the time channels that a spectrum is binned with. This only reads
+ *  members, so it may be called from several threads at once.
+ *  @param timeChannelsVec ::  vector holding the X data of each time regime
+ *  @param nspecNum ::  spectrum number
+ *  @param noTimeRegimes ::   number of time regimes
+ *  @return The time channels of the spectrum's time regime
+ *  @throw std::out_of_range if the spectrum has no time regime
+ */
+const boost::shared_ptr<HistogramData::HistogramX> &
+LoadRawHelper::spectrumTimeChannels(
+    const std::vector<boost::shared_ptr<HistogramData::HistogramX>>
+        &timeChannelsVec,
+    specnum_t nspecNum, int64_t noTimeRegimes) const {
+  if (noTimeRegimes < 2)
+    return timeChannelsVec[0];
+  // Use at() just in case spectrum missing from spec array
+  return timeChannelsVec.at(m_specTimeRegimes.at(nspecNum) - 1);
 }
 
 /** This method returns the monitor spectrum list
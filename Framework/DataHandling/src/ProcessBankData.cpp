@@ -7,12 +7,21 @@
 #include "MantidDataHandling/ProcessBankData.h"
 #include "MantidDataHandling/DefaultEventLoader.h"
 #include "MantidDataHandling/LoadEventNexus.h"
+#include "MantidKernel/EmptyValues.h"
+
+#include <limits>
+#include <numeric>
 
 using namespace Mantid::DataObjects;
 
 namespace Mantid {
 namespace DataHandling {
 
+namespace {
+/// Marks an event that is not compressed into any event list
+constexpr uint32_t NO_SLOT = std::numeric_limits<uint32_t>::max();
+} // namespace
+
 ProcessBankData::ProcessBankData(
     DefaultEventLoader &m_loader, std::string entry_name, API::Progress *prog,
     boost::shared_array<uint32_t> event_id,
@@ -49,7 +58,11 @@ void ProcessBankData::run() { // override {
   // ---- Pre-counting events per pixel ID ----
   auto &outputWS = m_loader.m_ws;
   auto *alg = m_loader.alg;
-  if (m_loader.precount) {
+  // Will we need to compress?
+  const bool compress = (alg->compressTolerance >= 0);
+  // Compressed events never go through the TofEvent vectors, so there is
+  // nothing to reserve
+  if (m_loader.precount && !compress) {
 
     std::vector<size_t> counts(m_max_id - m_min_id + 1, 0);
     for (size_t i = 0; i < numEvents; i++) {
@@ -104,13 +117,23 @@ void ProcessBankData::run() { // override {
 
   prog->report(entry_name + ": filling events");
 
-  // Will we need to compress?
-  bool compress = (alg->compressTolerance >= 0);
-
-  // Which detector IDs were touched? - only matters if compress is on
-  std::vector<bool> usedDetIds;
-  if (compress)
-    usedDetIds.assign(m_max_id - m_min_id + 1, false);
+  // When compressing, the events are not added to the event lists. Instead
+  // the (period, pixel) slot of each event is recorded so that the events of
+  // each pixel can be compressed straight into its list afterwards.
+  const size_t numPixels = static_cast<size_t>(m_max_id - m_min_id + 1);
+  const bool compressFat =
+      compress && !isEmpty(alg->compressWallClockTolerance);
+  std::vector<uint32_t> eventSlots;
+  std::vector<int64_t> eventPulseTimes;
+  if (compress) {
+    if (numPixels * m_loader.eventVectors.size() >= NO_SLOT ||
+        numEvents >= NO_SLOT)
+      throw std::runtime_error("Too many pixels or events in " + entry_name +
+                               " to compress while loading");
+    eventSlots.assign(numEvents, NO_SLOT);
+    if (compressFat)
+      eventPulseTimes.resize(numEvents);
+  }
 
   // Go through all events in the list
   for (std::size_t i = 0; i < numEvents; i++) {
@@ -153,8 +176,23 @@ void ProcessBankData::run() { // override {
       // Create the tofevent
       double tof = static_cast<double>(event_time_of_flight[i]);
       if ((tof >= alg->filter_tof_min) && (tof <= alg->filter_tof_max)) {
-        // Handle simulated data if present
-        if (have_weight) {
+        if (compress) {
+          // NULL eventVector indicates a bad spectrum lookup
+          const bool haveList =
+              have_weight
+                  ? m_loader.weightedEventVectors[periodIndex][detId] != nullptr
+                  : m_loader.eventVectors[periodIndex][detId] != nullptr;
+          if (haveList) {
+            eventSlots[i] = static_cast<uint32_t>(
+                static_cast<size_t>(periodIndex) * numPixels + detId -
+                m_min_id);
+            if (compressFat)
+              eventPulseTimes[i] = pulsetime.totalNanoseconds();
+          } else {
+            ++my_discarded_events;
+          }
+        } else if (have_weight) {
+          // Handle simulated data if present
           double weight = static_cast<double>(event_weight[i]);
           double errorSq = weight * weight;
           auto *eventVector = m_loader.weightedEventVectors[periodIndex][detId];
@@ -187,35 +225,14 @@ void ProcessBankData::run() { // override {
           }
         } else
           badTofs++;
-
-        // Track all the touched wi (only necessary when compressing events,
-        // for thread safety)
-        if (compress)
-          usedDetIds[detId - m_min_id] = true;
       } // valid time-of-flight
 
     } // valid detector IDs
   }   //(for each event)
 
-  //------------ Compress Events (or set sort order) ------------------
-  // Do it on all the detector IDs we touched
-  if (compress) {
-    for (detid_t pixID = m_min_id; pixID <= m_max_id; pixID++) {
-      if (usedDetIds[pixID - m_min_id]) {
-        // Find the the workspace index corresponding to that pixel ID
-        size_t wi = getWorkspaceIndexFromPixelID(pixID);
-        auto &el = outputWS.getSpectrum(wi);
-        if (compress)
-          el.compressEvents(alg->compressTolerance, &el);
-        else {
-          if (pulsetimesincreasing)
-            el.setSortOrder(DataObjects::PULSETIME_SORT);
-          else
-            el.setSortOrder(DataObjects::UNSORTED);
-        }
-      }
-    }
-  }
+  //------------ Compress Events ------------------
+  if (compress)
+    compressEvents(std::move(eventSlots), eventPulseTimes, numPixels);
   prog->report(entry_name + ": filled events");
 
   alg->getLogger().debug() << entry_name
@@ -243,6 +260,100 @@ void ProcessBankData::run() { // override {
 #endif
 } // END-OF-RUN()
 
+/**
+ * Compress the events of each pixel straight into its event list. The events
+ * are grouped by pixel with a counting sort, so the only memory needed on top
+ * of the arrays read from the file is one index per event and the events of a
+ * single pixel.
+ *
+ * @param eventSlots :: The (period, pixel) slot of each event, or NO_SLOT if
+ * the event was rejected
+ * @param eventPulseTimes :: The pulse time of each event in nanoseconds. Only
+ * used when compressing with a wall-clock tolerance.
+ * @param numPixels :: The number of pixel IDs handled by this task
+ */
+void ProcessBankData::compressEvents(
+    std::vector<uint32_t> eventSlots,
+    const std::vector<int64_t> &eventPulseTimes, const size_t numPixels) {
+  auto *alg = m_loader.alg;
+  auto &outputWS = m_loader.m_ws;
+  const size_t numSlots = numPixels * m_loader.eventVectors.size();
+
+  // Sort the event indices by slot
+  std::vector<size_t> offsets(numSlots + 1, 0);
+  for (const auto slot : eventSlots) {
+    if (slot != NO_SLOT)
+      ++offsets[slot + 1];
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  std::vector<uint32_t> order(offsets.back());
+  {
+    auto next = offsets;
+    for (size_t i = 0; i < eventSlots.size(); ++i) {
+      if (eventSlots[i] != NO_SLOT)
+        order[next[eventSlots[i]]++] = static_cast<uint32_t>(i);
+    }
+  }
+  std::vector<uint32_t>().swap(eventSlots);
+
+  const bool compressFat = !eventPulseTimes.empty();
+  // A negative tolerance tells EventList to compress logarithmically
+  const double tolerance = alg->compressLogarithmic ? -alg->compressTolerance
+                                                    : alg->compressTolerance;
+  auto compressInto = [&](EventList &events, EventList &destination) {
+    if (compressFat)
+      events.compressFatEvents(tolerance, alg->compressStartTime,
+                               alg->compressWallClockTolerance, &destination);
+    else
+      events.compressEvents(tolerance, &destination);
+  };
+  auto pulseTime = [&](const uint32_t i) {
+    return compressFat ? Types::Core::DateAndTime(eventPulseTimes[i])
+                       : Types::Core::DateAndTime();
+  };
+
+  // The events of one pixel, reused for every pixel
+  EventList pixelEvents;
+  if (have_weight)
+    pixelEvents.switchTo(API::WEIGHTED);
+  for (size_t slot = 0; slot < numSlots; ++slot) {
+    const auto begin = order.cbegin() + offsets[slot];
+    const auto end = order.cbegin() + offsets[slot + 1];
+    if (begin == end)
+      continue;
+    if (have_weight) {
+      auto &events = pixelEvents.getWeightedEvents();
+      events.clear();
+      for (auto it = begin; it != end; ++it) {
+        const double weight = static_cast<double>(event_weight[*it]);
+        events.emplace_back(static_cast<double>(event_time_of_flight[*it]),
+                            pulseTime(*it), weight, weight * weight);
+      }
+    } else {
+      auto &events = pixelEvents.getEvents();
+      events.clear();
+      for (auto it = begin; it != end; ++it)
+        events.emplace_back(static_cast<double>(event_time_of_flight[*it]),
+                            pulseTime(*it));
+    }
+    pixelEvents.setSortOrder(DataObjects::UNSORTED);
+
+    const auto pixID = static_cast<detid_t>(slot % numPixels) + m_min_id;
+    auto &el = outputWS.getSpectrum(getWorkspaceIndexFromPixelID(pixID),
+                                    slot / numPixels);
+    if (el.empty()) {
+      compressInto(pixelEvents, el);
+    } else {
+      // The pixel already has events from another bank
+      EventList compressed;
+      compressInto(pixelEvents, compressed);
+      el += compressed;
+    }
+    if (alg->getCancel())
+      break;
+  }
+}
+
 /**
  * Get the workspace index for a given pixel ID. Throws if the pixel ID is
  * not in the expected range.
@@ -715,6 +715,66 @@ public:
         ads.retrieveWS<MatrixWorkspace>("cncs_compressed")->monitorWorkspace());
   }
 
+  void test_Load_And_CompressEvents_logarithmic() {
+    LoadEventNexus ld;
+    std::string outws_name = "cncs_compressed_log";
+    ld.initialize();
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld.setPropertyValue("OutputWorkspace", outws_name);
+    ld.setPropertyValue("CompressTolerance", "0.001");
+    ld.setPropertyValue("CompressBinningMode", "Logarithmic");
+    ld.setProperty<bool>("LoadLogs", false); // Time-saver
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+
+    auto WS =
+        AnalysisDataService::Instance().retrieveWS<EventWorkspace>(outws_name);
+    TS_ASSERT(WS);
+    // Fewer events than the 112266 in the file
+    TS_ASSERT_LESS_THAN(WS->getNumberEvents(), 112266);
+    for (size_t wi = 0; wi < WS->getNumberHistograms(); wi++) {
+      if (WS->getSpectrum(wi).getNumberEvents() > 0)
+        TS_ASSERT_EQUALS(WS->getSpectrum(wi).getEventType(), WEIGHTED_NOTIME)
+    }
+    AnalysisDataService::Instance().remove(outws_name);
+  }
+
+  void test_Load_And_CompressEvents_wall_clock() {
+    LoadEventNexus ld;
+    std::string outws_name = "cncs_compressed_wall_clock";
+    ld.initialize();
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld.setPropertyValue("OutputWorkspace", outws_name);
+    ld.setPropertyValue("CompressTolerance", "0.05");
+    ld.setPropertyValue("CompressWallClockTolerance", "3600");
+    ld.setProperty<bool>("LoadLogs", false); // Time-saver
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+
+    auto WS =
+        AnalysisDataService::Instance().retrieveWS<EventWorkspace>(outws_name);
+    TS_ASSERT(WS);
+    TS_ASSERT_LESS_THAN(WS->getNumberEvents(), 112266);
+    for (size_t wi = 0; wi < WS->getNumberHistograms(); wi++) {
+      // The pulse times are kept
+      if (WS->getSpectrum(wi).getNumberEvents() > 0)
+        TS_ASSERT_EQUALS(WS->getSpectrum(wi).getEventType(), WEIGHTED)
+    }
+    AnalysisDataService::Instance().remove(outws_name);
+  }
+
+  void test_logarithmic_compression_with_wall_clock_tolerance_throws() {
+    LoadEventNexus ld;
+    ld.initialize();
+    ld.setRethrows(true);
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld.setPropertyValue("OutputWorkspace", "dummy");
+    ld.setPropertyValue("CompressTolerance", "0.001");
+    ld.setPropertyValue("CompressBinningMode", "Logarithmic");
+    ld.setPropertyValue("CompressWallClockTolerance", "10");
+    TS_ASSERT_THROWS(ld.execute(), const std::invalid_argument &);
+  }
+
   void doTestSingleBank(bool SingleBankPixelsOnly, bool Precount,
                         std::string BankName = "bank36",
                         bool willFail = false) {
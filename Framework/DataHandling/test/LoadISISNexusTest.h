@@ -491,6 +491,17 @@ public:
         boost::dynamic_pointer_cast<MatrixWorkspace>(grpWs->getItem(1));
     TS_ASSERT(ws1 != nullptr);
     TS_ASSERT(ws2 != nullptr);
+    // The detectors of all periods share a single time-of-flight axis
+    const size_t lastIndex = ws1->getNumberHistograms() - 1;
+    TS_ASSERT_EQUALS(&ws1->x(lastIndex), &ws2->x(lastIndex));
+    TS_ASSERT_EQUALS(&ws1->x(lastIndex), &ws1->x(lastIndex - 1));
+    // Errors are the square root of the counts
+    for (size_t i = 0; i < ws2->getNumberHistograms(); i += 100) {
+      const auto &y = ws2->y(i);
+      const auto &e = ws2->e(i);
+      for (size_t j = 0; j < y.size(); ++j)
+        TS_ASSERT_DELTA(e[j], std::sqrt(y[j]), 1e-12);
+    }
     // Check that workspace 1 has the correct period data, and no other period
     // log data
     checkPeriodLogData(ws1, 1);
@@ -294,6 +294,23 @@ public:
     TS_ASSERT_EQUALS(endTime.totalNanoseconds(), lastTime.totalNanoseconds());
   }
 
+  void test_only_allowed_logs_are_loaded() {
+    LoadNexusLogs ld;
+    ld.initialize();
+    ld.setPropertyValue("Filename", "REF_L_32035.nxs");
+    ld.setPropertyValue("AllowList", "Speed3,Phase1");
+    MatrixWorkspace_sptr ws = createTestWorkspace();
+    ld.setProperty("Workspace", ws);
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+
+    const auto &run = ws->run();
+    TS_ASSERT(run.hasProperty("Speed3"));
+    TS_ASSERT(run.hasProperty("Phase1"));
+    TS_ASSERT(!run.hasProperty("PhaseRequest1"));
+    TS_ASSERT_EQUALS(run.getLogData("Phase1")->units(), "microsecond");
+  }
+
 private:
   API::MatrixWorkspace_sptr createTestWorkspace() {
     return WorkspaceFactory::Instance().create("Workspace2D", 1, 1, 1);
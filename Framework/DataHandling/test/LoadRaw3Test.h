@@ -9,6 +9,7 @@
 
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/Axis.h"
+#include "MantidAPI/FileFinder.h"
 #include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidDataHandling/LoadRaw3.h"
@@ -18,9 +19,13 @@
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidKernel/Unit.h"
+#include "MantidTestHelpers/ScopedFileHelper.h"
 #include <boost/lexical_cast.hpp>
 #include <cxxtest/TestSuite.h>
 
+#include <fstream>
+#include <iterator>
+
 using namespace Mantid;
 using namespace Mantid::API;
 using namespace Mantid::DataHandling;
@@ -28,6 +33,7 @@ using namespace Mantid::DataObjects;
 using namespace Mantid::Geometry;
 using namespace Mantid::Kernel;
 using Mantid::Types::Core::DateAndTime;
+using ScopedFileHelper::ScopedFile;
 
 class LoadRaw3Test : public CxxTest::TestSuite {
 public:
@@ -1149,6 +1155,24 @@ public:
     AnalysisDataService::Instance().clear();
   }
 
+  void test_truncated_file_throws() {
+    std::ifstream raw(FileFinder::Instance().getFullPath(inputFile),
+                      std::ios::binary);
+    const std::string contents((std::istreambuf_iterator<char>(raw)),
+                               std::istreambuf_iterator<char>());
+    // Cut the file off in the middle of its data section
+    ScopedFile truncated(contents.substr(0, contents.size() / 2),
+                         "LoadRaw3Test_truncated.raw");
+
+    LoadRaw3 loader;
+    loader.initialize();
+    loader.setRethrows(true);
+    loader.setPropertyValue("Filename", truncated.getFileName());
+    loader.setPropertyValue("OutputWorkspace", "truncated");
+    TS_ASSERT_THROWS(loader.execute(), const std::runtime_error &);
+    TS_ASSERT(!AnalysisDataService::Instance().doesExist("truncated"));
+  }
+
 private:
   /// Helper method to run common set of tests on a workspace in a multi-period
   /// group.
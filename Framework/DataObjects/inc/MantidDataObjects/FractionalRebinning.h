@@ -41,6 +41,12 @@ getIntersectionRegion(const std::vector<double> &xAxis,
                       const Geometry::Quadrilateral &inputQ, size_t &qstart,
                       size_t &qend, size_t &x_start, size_t &x_end);
 
+/// Compute the overlap area of a quadrilateral with a rectangle
+MANTID_DATAOBJECTS_DLL double
+overlapWithRectangle(const Geometry::Quadrilateral &inputQ, const double xlo,
+                     const double xhi, const double ylo, const double yhi,
+                     double &minX, double &maxX);
+
 /// Compute sqrt of errors and put back in bin width division if necessary
 MANTID_DATAOBJECTS_DLL void
 normaliseOutput(API::MatrixWorkspace_sptr outputWS,
@@ -0,0 +1,68 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAOBJECTS_PEAKSPATIALINDEX_H_
+#define MANTID_DATAOBJECTS_PEAKSPATIALINDEX_H_
+
+#include "MantidKernel/SpecialCoordinateSystem.h"
+#include "MantidKernel/System.h"
+#include "MantidKernel/V3D.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Mantid {
+namespace Geometry {
+class IPeak;
+}
+namespace DataObjects {
+class PeaksWorkspace;
+
+/** PeakSpatialIndex : A uniform grid over a set of peak positions that allows
+  finding all of the peaks within a given distance of a point without looking
+  at every peak in the workspace.
+
+  The positions are bucketed into cubic cells of a fixed size. A query only
+  visits the cells overlapping the bounding box of the query sphere, so for a
+  cell size comparable to the query radius each query costs O(1) on average
+  instead of O(number of peaks).
+*/
+class DLLExport PeakSpatialIndex {
+public:
+  PeakSpatialIndex(std::vector<Kernel::V3D> positions, const double cellSize);
+  PeakSpatialIndex(const PeaksWorkspace &peaksWS,
+                   const Kernel::SpecialCoordinateSystem frame,
+                   const double cellSize);
+
+  /// Number of positions in the index
+  size_t size() const { return m_positions.size(); }
+  /// The i-th position in the index
+  const Kernel::V3D &position(const size_t i) const { return m_positions[i]; }
+
+  std::vector<size_t> findWithinRadius(const Kernel::V3D &centre,
+                                       const double radius) const;
+
+  static Kernel::V3D peakPosition(const Geometry::IPeak &peak,
+                                  const Kernel::SpecialCoordinateSystem frame);
+
+private:
+  int64_t cellIndex(const double coordinate) const;
+  static uint64_t cellKey(const int64_t i, const int64_t j, const int64_t k);
+  void buildCells();
+
+  /// The indexed positions
+  std::vector<Kernel::V3D> m_positions;
+  /// Length of the side of a grid cell
+  double m_cellSize;
+  /// Indices of the positions that fall into each occupied cell
+  std::unordered_map<uint64_t, std::vector<size_t>> m_cells;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_PEAKSPATIALINDEX_H_ */
@@ -95,8 +95,10 @@ protected:
   /// a vector holding workspace index of monitors in the workspace
   std::vector<specnum_t> m_monitorList;
 
-  /// A vector that holds the 1D histograms
-  std::vector<std::unique_ptr<Histogram1D>> data;
+  /// A vector that holds the 1D histograms. They are stored by value so that
+  /// creating, copying and destroying a workspace needs a single allocation
+  /// for all of the spectra rather than one per spectrum.
+  std::vector<Histogram1D> data;
 
 private:
   Workspace2D *doClone() const override;
@@ -1470,7 +1470,7 @@ inline double calcNorm(const double errorSquared) {
  * @param events :: input event list.
  * @param out :: output WeightedEventNoTime vector.
  * @param tolerance :: how close do two event's TOF have to be to be considered
- *the same.
+ *the same. A negative value is a relative tolerance, |tolerance| * TOF.
  */
 
 template <class T>
@@ -1492,9 +1492,15 @@ EventList::compressEventsHelper(const std::vector<T> &events,
   double weight = 0;
   double errorSquared = 0;
   double normalization = 0.;
+  // Logarithmic compression uses a tolerance proportional to the TOF
+  const bool logarithmic = (tolerance < 0.);
+  const double relativeTolerance = std::fabs(tolerance);
 
   for (auto it = events.cbegin(); it != events.cend(); it++) {
-    if ((it->m_tof - lastTof) <= tolerance) {
+    const bool withinTolerance =
+        logarithmic ? (it->m_tof - lastTof) <= relativeTolerance * lastTof
+                    : (it->m_tof - lastTof) <= tolerance;
+    if (withinTolerance) {
       // Carry the error and weight
       weight += it->weight();
       errorSquared += it->errorSquared();
@@ -1748,7 +1754,8 @@ inline void EventList::compressFatEventsHelper(
  * The event list will be switched to WeightedEventNoTime.
  *
  * @param tolerance :: how close do two event's TOF have to be to be considered
- *the same.
+ *the same. A negative tolerance compresses logarithmically: events are
+ *combined while they are within |tolerance| * TOF of the first one.
  * @param destination :: EventList that will receive the compressed events. Can
  *be == this.
  */
@@ -12,6 +12,8 @@
 #include "MantidGeometry/Math/Quadrilateral.h"
 #include "MantidKernel/V2D.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
 
@@ -49,6 +51,135 @@ namespace FractionalRebinning {
 
 const double POS_TOLERANCE = 1.e-10;
 
+namespace {
+/// Maximum number of vertices of a convex quadrilateral clipped by a
+/// rectangle: each of the four edges of the rectangle adds at most one vertex
+constexpr size_t MAX_CLIPPED_VERTICES = 8;
+
+/// A polygon stored on the stack, used while clipping
+struct ClipPolygon {
+  std::array<double, MAX_CLIPPED_VERTICES> x;
+  std::array<double, MAX_CLIPPED_VERTICES> y;
+  size_t size{0};
+
+  /// Append a vertex, returning false if the polygon is already full
+  bool add(const double px, const double py) {
+    if (size == MAX_CLIPPED_VERTICES)
+      return false;
+    x[size] = px;
+    y[size] = py;
+    ++size;
+    return true;
+  }
+};
+
+/**
+ * One step of the Sutherland-Hodgman algorithm: clip a convex polygon by the
+ * half plane on one side of a line parallel to an axis.
+ * @param in The polygon to clip
+ * @param out The clipped polygon
+ * @param alongX If true the line is x = bound, otherwise y = bound
+ * @param bound The position of the line
+ * @param keepAbove If true the half plane above the line is kept
+ * @return False if the clipped polygon has too many vertices to be stored
+ */
+bool clipByLine(const ClipPolygon &in, ClipPolygon &out, const bool alongX,
+                const double bound, const bool keepAbove) {
+  out.size = 0;
+  if (in.size == 0)
+    return true;
+  const auto &coord = alongX ? in.x : in.y;
+  const auto isInside = [&](const size_t i) {
+    return keepAbove ? coord[i] >= bound : coord[i] <= bound;
+  };
+  size_t previous = in.size - 1;
+  bool previousInside = isInside(previous);
+  for (size_t current = 0; current < in.size; ++current) {
+    const bool currentInside = isInside(current);
+    if (currentInside != previousInside) {
+      // The edge crosses the line, add the crossing point
+      const double t =
+          (bound - coord[previous]) / (coord[current] - coord[previous]);
+      const bool added =
+          alongX
+              ? out.add(bound,
+                        in.y[previous] + t * (in.y[current] - in.y[previous]))
+              : out.add(in.x[previous] + t * (in.x[current] - in.x[previous]),
+                        bound);
+      if (!added)
+        return false;
+    }
+    if (currentInside && !out.add(in.x[current], in.y[current]))
+      return false;
+    previous = current;
+    previousInside = currentInside;
+  }
+  return true;
+}
+
+/**
+ * Compute the overlap with ConvexPolygon and PolygonIntersection. This is
+ * only used when clipping produces more vertices than ClipPolygon can hold,
+ * which can only happen for a quadrilateral that is not convex.
+ */
+double overlapByIntersection(const Quadrilateral &inputQ, const double xlo,
+                             const double xhi, const double ylo,
+                             const double yhi, double &minX, double &maxX) {
+  ConvexPolygon overlap;
+  if (!intersection(Quadrilateral(xlo, xhi, ylo, yhi), inputQ, overlap))
+    return 0.;
+  const double area = overlap.area();
+  if (area != 0.) {
+    minX = overlap.minX();
+    maxX = overlap.maxX();
+  }
+  return area;
+}
+} // namespace
+
+/**
+ * Compute the overlap of a quadrilateral with an axis-aligned rectangle. The
+ * quadrilateral is clipped by the rectangle without any heap allocation,
+ * falling back to PolygonIntersection if the clipped polygon does not fit.
+ * @param inputQ The quadrilateral
+ * @param xlo The lower x edge of the rectangle
+ * @param xhi The upper x edge of the rectangle
+ * @param ylo The lower y edge of the rectangle
+ * @param yhi The upper y edge of the rectangle
+ * @param minX Output: the smallest x of the overlap if the area is non-zero
+ * @param maxX Output: the largest x of the overlap if the area is non-zero
+ * @return The area of the overlap
+ */
+double overlapWithRectangle(const Quadrilateral &inputQ, const double xlo,
+                            const double xhi, const double ylo,
+                            const double yhi, double &minX, double &maxX) {
+  ClipPolygon poly, clipped;
+  for (size_t i = 0; i < 4; ++i)
+    poly.add(inputQ[i].X(), inputQ[i].Y());
+  if (!(clipByLine(poly, clipped, true, xlo, true) &&
+        clipByLine(clipped, poly, true, xhi, false) &&
+        clipByLine(poly, clipped, false, ylo, true) &&
+        clipByLine(clipped, poly, false, yhi, false)))
+    return overlapByIntersection(inputQ, xlo, xhi, ylo, yhi, minX, maxX);
+  if (poly.size < 3)
+    return 0.;
+  // Shoelace formula
+  double area = 0.;
+  size_t previous = poly.size - 1;
+  for (size_t current = 0; current < poly.size; ++current) {
+    area += poly.x[previous] * poly.y[current] -
+            poly.x[current] * poly.y[previous];
+    previous = current;
+  }
+  if (area == 0.)
+    return 0.;
+  const auto xRange =
+      std::minmax_element(poly.x.cbegin(), poly.x.cbegin() + poly.size);
+  minX = *xRange.first;
+  maxX = *xRange.second;
+  return 0.5 * std::abs(area);
+}
+
 enum class QuadrilateralType { Rectangle, TrapezoidX, TrapezoidY, General };
 
 /**
@@ -317,7 +448,6 @@ void calcTrapezoidYIntersections(const std::vector<double> &xAxis,
   // Step 2 - loop over x, creating one-bin wide strips
   V2D nll(ll), nul(ul), nur, nlr, l0, r0, l1, r1;
   double area(0.);
-  ConvexPolygon poly;
   areaInfos.reserve(nx * ny);
   size_t yj0, yj1;
   for (size_t xi = x_start; xi < x_end; ++xi) {
@@ -471,19 +601,16 @@ void calcGeneralIntersections(const std::vector<double> &xAxis,
                               const size_t qend, const size_t x_start,
                               const size_t x_end,
                               std::vector<AreaInfo> &areaInfos) {
-  ConvexPolygon intersectOverlap;
   areaInfos.reserve((qend - qstart) * (x_end - x_start));
+  double minX, maxX;
   for (size_t yi = qstart; yi < qend; ++yi) {
     const double vlo = yAxis[yi];
     const double vhi = yAxis[yi + 1];
     for (size_t xi = x_start; xi < x_end; ++xi) {
-      intersectOverlap.clear();
-      if (intersection(
-              Quadrilateral(V2D(xAxis[xi], vlo), V2D(xAxis[xi + 1], vlo),
-                            V2D(xAxis[xi + 1], vhi), V2D(xAxis[xi], vhi)),
-              inputQ, intersectOverlap)) {
-        areaInfos.emplace_back(xi, yi, intersectOverlap.area());
-      }
+      const double area = overlapWithRectangle(inputQ, xAxis[xi], xAxis[xi + 1],
+                                               vlo, vhi, minX, maxX);
+      if (area > 0.)
+        areaInfos.emplace_back(xi, yi, area);
     }
   }
 }
@@ -547,40 +674,52 @@ void rebinToOutput(const Quadrilateral &inputQ,
     return;
 
   const auto &inE = inputWS->e(i);
-  // It seems to be more efficient to construct this once and clear it before
-  // each calculation in the loop
-  ConvexPolygon intersectOverlap;
+  const double inputQArea = inputQ.area();
+  const bool isDistribution = inputWS->isDistribution();
+  // Collect the contributions first so that the output is only locked once.
+  // The buffer is kept per thread to avoid an allocation for every input bin.
+  struct Contribution {
+    size_t wsIndex;
+    size_t binIndex;
+    double signal;
+    double variance;
+  };
+  thread_local std::vector<Contribution> contributions;
+  contributions.clear();
+  double minX, maxX;
   for (size_t y = qstart; y < qend; ++y) {
     const double vlo = verticalAxis[y];
     const double vhi = verticalAxis[y + 1];
     for (size_t xi = x_start; xi < x_end; ++xi) {
-      intersectOverlap.clear();
-      if (intersection(Quadrilateral(V2D(X[xi], vlo), V2D(X[xi + 1], vlo),
-                                     V2D(X[xi + 1], vhi), V2D(X[xi], vhi)),
-                       inputQ, intersectOverlap)) {
-        const double overlapArea = intersectOverlap.area();
-        if (overlapArea == 0.) {
-          continue;
-        }
-        const double weight = overlapArea / inputQ.area();
-        double yValue = inY[j];
-        yValue *= weight;
-        double eValue = inE[j];
-        if (inputWS->isDistribution()) {
-          const double overlapWidth =
-              intersectOverlap.maxX() - intersectOverlap.minX();
-          yValue *= overlapWidth;
-          eValue *= overlapWidth;
-        }
-        eValue = eValue * eValue * weight;
-        PARALLEL_CRITICAL(overlap_sum) {
-          // The mutable calls must be in the critical section
-          // so that any calls from omp sections can write to the
-          // output workspace safely
-          outputWS.mutableY(y)[xi] += yValue;
-          outputWS.mutableE(y)[xi] += eValue;
-        }
+      const double overlapArea =
+          overlapWithRectangle(inputQ, X[xi], X[xi + 1], vlo, vhi, minX, maxX);
+      if (overlapArea == 0.) {
+        continue;
       }
+      const double weight = overlapArea / inputQArea;
+      double yValue = inY[j];
+      yValue *= weight;
+      double eValue = inE[j];
+      if (isDistribution) {
+        const double overlapWidth = maxX - minX;
+        yValue *= overlapWidth;
+        eValue *= overlapWidth;
+      }
+      eValue = eValue * eValue * weight;
+      contributions.push_back({y, xi, yValue, eValue});
+    }
+  }
+  if (contributions.empty())
+    return;
+  PARALLEL_CRITICAL(overlap_sum) {
+    // The mutable calls must be in the critical section
+    // so that any calls from omp sections can write to the
+    // output workspace safely
+    for (const auto &contribution : contributions) {
+      outputWS.mutableY(contribution.wsIndex)[contribution.binIndex] +=
+          contribution.signal;
+      outputWS.mutableE(contribution.wsIndex)[contribution.binIndex] +=
+          contribution.variance;
     }
   }
 }
@@ -667,15 +806,16 @@ void rebinToFractionalOutput(const Quadrilateral &inputQ,
   }
 
   const double variance = error * error;
-  for (const auto &ai : areaInfos) {
-    if (ai.weight == 0.) {
-      continue;
-    }
-    const double weight = ai.weight / inputQArea;
-    PARALLEL_CRITICAL(overlap) {
-      // The mutable calls must be in the critical section
-      // so that any calls from omp sections can write to the
-      // output workspace safely
+  PARALLEL_CRITICAL(overlap) {
+    // The mutable calls must be in the critical section
+    // so that any calls from omp sections can write to the
+    // output workspace safely. All overlaps of this input bin are added
+    // while holding the lock once.
+    for (const auto &ai : areaInfos) {
+      if (ai.weight == 0.) {
+        continue;
+      }
+      const double weight = ai.weight / inputQArea;
       outputWS.mutableY(ai.wsIndex)[ai.binIndex] += signal * weight;
       outputWS.mutableE(ai.wsIndex)[ai.binIndex] += variance * weight;
       outputWS.dataF(ai.wsIndex)[ai.binIndex] += weight * inputWeight;
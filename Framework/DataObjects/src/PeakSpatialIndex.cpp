@@ -0,0 +1,181 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/PeakSpatialIndex.h"
+#include "MantidDataObjects/PeaksWorkspace.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+namespace Mantid {
+namespace DataObjects {
+
+using Kernel::V3D;
+
+namespace {
+/// Number of bits used for each cell coordinate in a cell key
+constexpr int BITS_PER_DIMENSION = 21;
+constexpr uint64_t DIMENSION_MASK = (uint64_t(1) << BITS_PER_DIMENSION) - 1;
+/// Cell indices are clamped to this range to keep the conversion defined
+constexpr double MAX_CELL_INDEX = 4.0e18;
+
+std::vector<V3D> peakPositions(const PeaksWorkspace &peaksWS,
+                               const Kernel::SpecialCoordinateSystem frame) {
+  const int nPeaks = peaksWS.getNumberPeaks();
+  std::vector<V3D> positions;
+  positions.reserve(static_cast<size_t>(nPeaks));
+  for (int i = 0; i < nPeaks; ++i) {
+    positions.emplace_back(
+        PeakSpatialIndex::peakPosition(peaksWS.getPeak(i), frame));
+  }
+  return positions;
+}
+} // namespace
+
+/**
+ * Build the index over a list of positions
+ * @param positions :: The positions to index. A query returns indices into
+ * this list.
+ * @param cellSize :: The side of a grid cell. Queries are fastest for radii
+ * close to this value.
+ * @throws std::invalid_argument if the cell size is not a positive number
+ */
+PeakSpatialIndex::PeakSpatialIndex(std::vector<V3D> positions,
+                                   const double cellSize)
+    : m_positions(std::move(positions)), m_cellSize(cellSize) {
+  if (!(cellSize > 0.0) || !std::isfinite(cellSize)) {
+    throw std::invalid_argument(
+        "PeakSpatialIndex: the cell size must be a positive number.");
+  }
+  buildCells();
+}
+
+/**
+ * Build the index over the peaks of a workspace. The position of the i-th
+ * peak in the workspace has index i.
+ * @param peaksWS :: The peaks to index
+ * @param frame :: The coordinate frame of the positions
+ * @param cellSize :: The side of a grid cell
+ */
+PeakSpatialIndex::PeakSpatialIndex(const PeaksWorkspace &peaksWS,
+                                   const Kernel::SpecialCoordinateSystem frame,
+                                   const double cellSize)
+    : PeakSpatialIndex(peakPositions(peaksWS, frame), cellSize) {}
+
+/**
+ * Find all the positions closer than a given distance to a point.
+ * @param centre :: The centre of the query sphere
+ * @param radius :: The radius of the query sphere
+ * @return The indices of the positions strictly inside the sphere, in
+ * ascending order
+ */
+std::vector<size_t>
+PeakSpatialIndex::findWithinRadius(const V3D &centre,
+                                   const double radius) const {
+  std::vector<size_t> found;
+  if (!(radius > 0.0))
+    return found;
+  const double radiusSq = radius * radius;
+  auto isInside = [&](const size_t index) {
+    const V3D diff = m_positions[index] - centre;
+    return diff.scalar_prod(diff) < radiusSq;
+  };
+
+  std::array<int64_t, 3> lower, upper;
+  double cellsToVisit = 1.0;
+  for (size_t d = 0; d < 3; ++d) {
+    lower[d] = cellIndex(centre[d] - radius);
+    upper[d] = cellIndex(centre[d] + radius);
+    cellsToVisit *= static_cast<double>(upper[d] - lower[d] + 1);
+  }
+
+  if (cellsToVisit > static_cast<double>(m_positions.size())) {
+    // The query sphere is large compared with the cells: a linear scan is
+    // cheaper than visiting the (mostly empty) cells.
+    for (size_t index = 0; index < m_positions.size(); ++index) {
+      if (isInside(index))
+        found.emplace_back(index);
+    }
+    return found;
+  }
+
+  for (int64_t i = lower[0]; i <= upper[0]; ++i) {
+    for (int64_t j = lower[1]; j <= upper[1]; ++j) {
+      for (int64_t k = lower[2]; k <= upper[2]; ++k) {
+        const auto cell = m_cells.find(cellKey(i, j, k));
+        if (cell == m_cells.end())
+          continue;
+        for (const auto index : cell->second) {
+          if (isInside(index))
+            found.emplace_back(index);
+        }
+      }
+    }
+  }
+  // Cells far apart may share a key, so a position can be seen twice.
+  std::sort(found.begin(), found.end());
+  found.erase(std::unique(found.begin(), found.end()), found.end());
+  return found;
+}
+
+/**
+ * Get the position of a peak in a given coordinate frame.
+ * @param peak :: A peak
+ * @param frame :: The coordinate frame
+ * @return The position of the peak or (0,0,0) if the frame is not one of
+ * QLab, QSample or HKL
+ */
+V3D PeakSpatialIndex::peakPosition(
+    const Geometry::IPeak &peak, const Kernel::SpecialCoordinateSystem frame) {
+  switch (frame) {
+  case Kernel::QLab:
+    return peak.getQLabFrame();
+  case Kernel::QSample:
+    return peak.getQSampleFrame();
+  case Kernel::HKL:
+    return peak.getHKL();
+  default:
+    return V3D();
+  }
+}
+
+/// Index of the cell containing a coordinate along one dimension
+int64_t PeakSpatialIndex::cellIndex(const double coordinate) const {
+  const double index = std::floor(coordinate / m_cellSize);
+  if (std::isnan(index))
+    return 0;
+  return static_cast<int64_t>(
+      std::max(-MAX_CELL_INDEX, std::min(MAX_CELL_INDEX, index)));
+}
+
+/**
+ * Pack the three indices of a cell into a single key. Only the lowest
+ * BITS_PER_DIMENSION bits of each index are kept, so cells that are more than
+ * 2^BITS_PER_DIMENSION cells apart may share a key. This only adds candidates
+ * to a query, which are then rejected by the distance check.
+ */
+uint64_t PeakSpatialIndex::cellKey(const int64_t i, const int64_t j,
+                                   const int64_t k) {
+  return ((static_cast<uint64_t>(i) & DIMENSION_MASK)
+          << (2 * BITS_PER_DIMENSION)) |
+         ((static_cast<uint64_t>(j) & DIMENSION_MASK) << BITS_PER_DIMENSION) |
+         (static_cast<uint64_t>(k) & DIMENSION_MASK);
+}
+
+/// Bucket all of the positions into the grid cells
+void PeakSpatialIndex::buildCells() {
+  for (size_t index = 0; index < m_positions.size(); ++index) {
+    const auto &pos = m_positions[index];
+    const auto key =
+        cellKey(cellIndex(pos.X()), cellIndex(pos.Y()), cellIndex(pos.Z()));
+    m_cells[key].emplace_back(index);
+  }
+}
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -30,12 +30,8 @@ Workspace2D::Workspace2D(const Parallel::StorageMode storageMode)
     : HistoWorkspace(storageMode) {}
 
 Workspace2D::Workspace2D(const Workspace2D &other)
-    : HistoWorkspace(other), m_monitorList(other.m_monitorList) {
-  data.resize(other.data.size());
-  for (size_t i = 0; i < data.size(); ++i) {
-    data[i] = std::make_unique<Histogram1D>(*(other.data[i]));
-  }
-}
+    : HistoWorkspace(other), m_monitorList(other.m_monitorList),
+      data(other.data) {}
 
 /// Destructor
 Workspace2D::~Workspace2D() {}
@@ -54,8 +50,6 @@ Workspace2D::~Workspace2D() {}
  */
 void Workspace2D::init(const std::size_t &NVectors, const std::size_t &XLength,
                        const std::size_t &YLength) {
-  data.resize(NVectors);
-
   auto x = Kernel::make_cow<HistogramData::HistogramX>(
       XLength, HistogramData::LinearGenerator(1.0, 1.0));
   HistogramData::Counts y(YLength);
@@ -65,10 +59,10 @@ void Workspace2D::init(const std::size_t &NVectors, const std::size_t &XLength,
   spec.setX(x);
   spec.setCounts(y);
   spec.setCountStandardDeviations(e);
+  data.assign(NVectors, spec);
   for (size_t i = 0; i < data.size(); i++) {
-    data[i] = std::make_unique<Histogram1D>(spec);
     // Default spectrum number = starts at 1, for workspace index 0.
-    data[i]->setSpectrumNo(specnum_t(i + 1));
+    data[i].setSpectrumNo(specnum_t(i + 1));
   }
 
   // Add axes that reference the data
@@ -78,8 +72,6 @@ void Workspace2D::init(const std::size_t &NVectors, const std::size_t &XLength,
 }
 
 void Workspace2D::init(const HistogramData::Histogram &histogram) {
-  data.resize(numberOfDetectorGroups());
-
   HistogramData::Histogram initializedHistogram(histogram);
   if (!histogram.sharedY()) {
     if (histogram.yMode() == HistogramData::Histogram::YMode::Frequencies) {
@@ -94,9 +86,7 @@ void Workspace2D::init(const HistogramData::Histogram &histogram) {
 
   Histogram1D spec(initializedHistogram.xMode(), initializedHistogram.yMode());
   spec.setHistogram(initializedHistogram);
-  for (auto &i : data) {
-    i = std::make_unique<Histogram1D>(spec);
-  }
+  data.assign(numberOfDetectorGroups(), spec);
 
   // Add axes that reference the data
   m_axes.resize(2);
@@ -115,8 +105,8 @@ size_t Workspace2D::getNumberHistograms() const {
 size_t Workspace2D::size() const {
   return std::accumulate(
       data.begin(), data.end(), static_cast<size_t>(0),
-      [](const size_t value, const std::unique_ptr<Histogram1D> &histo) {
-        return value + histo->size();
+      [](const size_t value, const Histogram1D &histo) {
+        return value + histo.size();
       });
 }
 
@@ -125,9 +115,9 @@ size_t Workspace2D::blocksize() const {
   if (data.empty()) {
     return 0;
   } else {
-    size_t numBins = data[0]->size();
+    size_t numBins = data[0].size();
     for (const auto &iter : data)
-      if (numBins != iter->size())
+      if (numBins != iter.size())
         throw std::length_error(
             "blocksize undefined because size of histograms is not equal");
     return numBins;
@@ -222,8 +212,8 @@ void Workspace2D::setImageYAndE(const API::MantidImage &imageY,
       auto pE = rowE.begin();
       for (auto pY = rowY.begin(); pY != rowY.end() && pE != rowE.end();
            ++pY, ++pE, ++spec) {
-        data[spec]->dataY()[0] = *pY;
-        data[spec]->dataE()[0] = *pE;
+        data[spec].dataY()[0] = *pY;
+        data[spec].dataE()[0] = *pE;
       }
     }
   } else {
@@ -250,18 +240,18 @@ void Workspace2D::setImageYAndE(const API::MantidImage &imageY,
 
       const auto &rowY = imageY[i];
       const auto &rowE = imageE[i];
-      data[i]->dataY() = rowY;
-      data[i]->dataE() = rowE;
+      data[i].dataY() = rowY;
+      data[i].dataE() = rowE;
     }
     // X values. Set first spectrum and copy/propagate that one to all the other
     // spectra
     PARALLEL_FOR_IF(parallelExecution)
     for (int i = 0; i < static_cast<int>(width) + 1; ++i) {
-      data[0]->dataX()[i] = i * scale_1;
+      data[0].dataX()[i] = i * scale_1;
     }
     PARALLEL_FOR_IF(parallelExecution)
     for (int i = 1; i < static_cast<int>(height); ++i) {
-      data[i]->setX(data[0]->ptrX());
+      data[i].setX(data[0].ptrX());
     }
   }
 }
@@ -282,7 +272,7 @@ const Histogram1D &Workspace2D::getSpectrum(const size_t index) const {
        << " out of range " << data.size();
     throw std::range_error(ss.str());
   }
-  return *data[index];
+  return data[index];
 }
 
 //--------------------------------------------------------------------------------------------
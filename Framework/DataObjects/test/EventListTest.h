@@ -2159,6 +2159,33 @@ public:
     }   // starting event type
   }
 
+  void test_compressEvents_logarithmic() {
+    el = EventList();
+    el.addEventQuickly(TofEvent(1009.0, 22));
+    el.addEventQuickly(TofEvent(100.0, 33));
+    el.addEventQuickly(TofEvent(1011.0, 44));
+    el.addEventQuickly(TofEvent(100.5, 55));
+    el.addEventQuickly(TofEvent(1000.0, 66));
+    el.addEventQuickly(TofEvent(101.5, 77));
+
+    // Events within 1% of the first TOF of a group are combined
+    TS_ASSERT_THROWS_NOTHING(el.compressEvents(-0.01, &el));
+    TS_ASSERT_EQUALS(el.getEventType(), WEIGHTED_NOTIME);
+    TS_ASSERT(el.isSortedByTof());
+    TS_ASSERT_EQUALS(el.getNumberEvents(), 4);
+    if (el.getNumberEvents() == 4) {
+      TS_ASSERT_DELTA(el.getEvent(0).tof(), 100.25, 1e-5);
+      TS_ASSERT_DELTA(el.getEvent(0).weight(), 2., 1e-5);
+      TS_ASSERT_DELTA(el.getEvent(1).tof(), 101.5, 1e-5);
+      TS_ASSERT_DELTA(el.getEvent(1).weight(), 1., 1e-5);
+      TS_ASSERT_DELTA(el.getEvent(2).tof(), 1004.5, 1e-5);
+      TS_ASSERT_DELTA(el.getEvent(2).weight(), 2., 1e-5);
+      TS_ASSERT_DELTA(el.getEvent(2).errorSquared(), 2., 1e-5);
+      TS_ASSERT_DELTA(el.getEvent(3).tof(), 1011.0, 1e-5);
+      TS_ASSERT_DELTA(el.getEvent(3).weight(), 1., 1e-5);
+    }
+  }
+
   void test_compressFatEvents() {
     // no pulse time should throw an exception
     EventList el_notime_output;
@@ -0,0 +1,90 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAOBJECTS_FRACTIONALREBINNINGTEST_H_
+#define MANTID_DATAOBJECTS_FRACTIONALREBINNINGTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/FractionalRebinning.h"
+#include "MantidKernel/V2D.h"
+
+using Mantid::DataObjects::FractionalRebinning::overlapWithRectangle;
+using Mantid::Geometry::Quadrilateral;
+using Mantid::Kernel::V2D;
+
+class FractionalRebinningTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static FractionalRebinningTest *createSuite() {
+    return new FractionalRebinningTest();
+  }
+  static void destroySuite(FractionalRebinningTest *suite) { delete suite; }
+
+  void test_overlap_of_quadrilateral_fully_inside_rectangle() {
+    const Quadrilateral quad(V2D(1., 1.), V2D(3., 1.5), V2D(2.5, 3.),
+                             V2D(1.5, 2.5));
+    double minX(0.), maxX(0.);
+    const double area = overlapWithRectangle(quad, 0., 4., 0., 4., minX, maxX);
+    TS_ASSERT_DELTA(area, quad.area(), 1e-12);
+    TS_ASSERT_DELTA(minX, 1., 1e-12);
+    TS_ASSERT_DELTA(maxX, 3., 1e-12);
+  }
+
+  void test_overlap_of_rectangle_fully_inside_quadrilateral() {
+    const Quadrilateral quad(V2D(-1., -1.), V2D(5., -2.), V2D(6., 5.),
+                             V2D(-2., 4.));
+    double minX(0.), maxX(0.);
+    const double area = overlapWithRectangle(quad, 1., 2., 1., 3., minX, maxX);
+    TS_ASSERT_DELTA(area, 2., 1e-12);
+    TS_ASSERT_DELTA(minX, 1., 1e-12);
+    TS_ASSERT_DELTA(maxX, 2., 1e-12);
+  }
+
+  void test_overlap_of_partly_overlapping_quadrilateral() {
+    // A unit square rotated by 45 degrees centred on the corner (1, 1) of the
+    // rectangle, so that a quarter of it is inside
+    const double h = 0.5 * M_SQRT2;
+    const Quadrilateral quad(V2D(1., 1. - h), V2D(1. + h, 1.), V2D(1., 1. + h),
+                             V2D(1. - h, 1.));
+    double minX(0.), maxX(0.);
+    const double area = overlapWithRectangle(quad, 0., 1., 0., 1., minX, maxX);
+    TS_ASSERT_DELTA(area, 0.25, 1e-12);
+    TS_ASSERT_DELTA(minX, 1. - h, 1e-12);
+    TS_ASSERT_DELTA(maxX, 1., 1e-12);
+  }
+
+  void test_quadrilateral_touching_an_edge_has_no_overlap() {
+    const Quadrilateral quad(V2D(1., 0.), V2D(2., 0.), V2D(2.5, 1.),
+                             V2D(1., 1.));
+    double minX(-1.), maxX(-1.);
+    const double area = overlapWithRectangle(quad, 0., 1., 0., 1., minX, maxX);
+    TS_ASSERT_EQUALS(area, 0.);
+    TS_ASSERT_EQUALS(minX, -1.);
+    TS_ASSERT_EQUALS(maxX, -1.);
+  }
+
+  void test_degenerate_quadrilateral_has_no_overlap() {
+    // All vertices on a line through the rectangle
+    const Quadrilateral quad(V2D(0., 0.), V2D(0.5, 0.5), V2D(1., 1.),
+                             V2D(0.25, 0.25));
+    double minX(-1.), maxX(-1.);
+    const double area = overlapWithRectangle(quad, 0., 1., 0., 1., minX, maxX);
+    TS_ASSERT_EQUALS(area, 0.);
+    TS_ASSERT_EQUALS(minX, -1.);
+    TS_ASSERT_EQUALS(maxX, -1.);
+  }
+
+  void test_non_overlapping_quadrilateral_has_no_overlap() {
+    const Quadrilateral quad(2., 3., 2., 3.);
+    double minX(-1.), maxX(-1.);
+    const double area = overlapWithRectangle(quad, 0., 1., 0., 1., minX, maxX);
+    TS_ASSERT_EQUALS(area, 0.);
+  }
+};
+
+#endif /* MANTID_DATAOBJECTS_FRACTIONALREBINNINGTEST_H_ */
@@ -0,0 +1,100 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAOBJECTS_PEAKSPATIALINDEXTEST_H_
+#define MANTID_DATAOBJECTS_PEAKSPATIALINDEXTEST_H_
+
+#include "MantidDataObjects/PeakSpatialIndex.h"
+#include "MantidDataObjects/PeaksWorkspace.h"
+#include "MantidKernel/V3D.h"
+#include "MantidTestHelpers/ComponentCreationHelper.h"
+
+#include <cxxtest/TestSuite.h>
+#include <random>
+
+using Mantid::DataObjects::Peak;
+using Mantid::DataObjects::PeakSpatialIndex;
+using Mantid::DataObjects::PeaksWorkspace;
+using Mantid::Kernel::V3D;
+
+class PeakSpatialIndexTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static PeakSpatialIndexTest *createSuite() {
+    return new PeakSpatialIndexTest();
+  }
+  static void destroySuite(PeakSpatialIndexTest *suite) { delete suite; }
+
+  void test_invalid_cell_size_throws() {
+    TS_ASSERT_THROWS(PeakSpatialIndex({V3D(1, 2, 3)}, 0.0),
+                     const std::invalid_argument &);
+    TS_ASSERT_THROWS(PeakSpatialIndex({V3D(1, 2, 3)}, -1.0),
+                     const std::invalid_argument &);
+  }
+
+  void test_empty_index_finds_nothing() {
+    PeakSpatialIndex index({}, 1.0);
+    TS_ASSERT_EQUALS(index.size(), 0);
+    TS_ASSERT(index.findWithinRadius(V3D(0, 0, 0), 10.0).empty());
+  }
+
+  void test_finds_positions_across_cell_boundaries() {
+    PeakSpatialIndex index({V3D(0.9, 0, 0), V3D(1.1, 0, 0), V3D(-0.05, 0, 0),
+                            V3D(3, 0, 0)},
+                           1.0);
+    const auto found = index.findWithinRadius(V3D(1.0, 0, 0), 1.06);
+    TS_ASSERT_EQUALS(found, std::vector<size_t>({0, 1, 2}));
+  }
+
+  void test_radius_is_exclusive() {
+    PeakSpatialIndex index({V3D(0, 0, 0), V3D(0, 2, 0)}, 1.0);
+    const auto found = index.findWithinRadius(V3D(0, 0, 0), 2.0);
+    TS_ASSERT_EQUALS(found, std::vector<size_t>({0}));
+  }
+
+  void test_matches_brute_force_search() {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> coordinate(-20.0, 20.0);
+    std::vector<V3D> positions;
+    for (size_t i = 0; i < 2000; ++i) {
+      positions.emplace_back(coordinate(generator), coordinate(generator),
+                             coordinate(generator));
+    }
+    for (const double cellSize : {0.3, 1.0, 7.0}) {
+      PeakSpatialIndex index(positions, cellSize);
+      for (size_t query = 0; query < 50; ++query) {
+        const V3D centre(coordinate(generator), coordinate(generator),
+                         coordinate(generator));
+        const double radius = 0.5 * static_cast<double>(query % 5 + 1);
+        std::vector<size_t> expected;
+        for (size_t i = 0; i < positions.size(); ++i) {
+          if (positions[i].distance(centre) < radius)
+            expected.emplace_back(i);
+        }
+        TS_ASSERT_EQUALS(index.findWithinRadius(centre, radius), expected);
+      }
+    }
+  }
+
+  void test_index_over_peaks_workspace() {
+    auto inst = ComponentCreationHelper::createTestInstrumentRectangular2(1, 10);
+    PeaksWorkspace peaksWS;
+    peaksWS.setInstrument(inst);
+    for (const auto &hkl : {V3D(1, 0, 0), V3D(1, 0, 1), V3D(4, 4, 4)}) {
+      Peak peak(inst, 1, 3.0);
+      peak.setHKL(hkl);
+      peaksWS.addPeak(peak);
+    }
+    PeakSpatialIndex index(peaksWS, Mantid::Kernel::HKL, 2.0);
+    TS_ASSERT_EQUALS(index.size(), 3);
+    TS_ASSERT_EQUALS(index.position(2), V3D(4, 4, 4));
+    TS_ASSERT_EQUALS(index.findWithinRadius(V3D(1, 0, 0), 1.5),
+                     std::vector<size_t>({0, 1}));
+  }
+};
+
+#endif /* MANTID_DATAOBJECTS_PEAKSPATIALINDEXTEST_H_ */
@@ -20,6 +20,14 @@ namespace Geometry {
   the unit cell by combining the space group and the scatterers located in the
   asymmetric unit (both taken from CrystalStructure) and stores them.
 
+  When all scatterers are IsotropicAtomBraggScatterers, which is the case for
+  structures created from a scatterer string, their positions, occupancies,
+  scattering lengths and displacement parameters are stored in arrays instead
+  and the sum over the atoms is calculated directly from those. The results
+  are the same as those of the scatterers, but no scatterer objects are
+  created for the unit cell and getFs() and getFsSquared() calculate the
+  structure factors of many reflections in parallel.
+
       @author Michael Wedel, ESS
       @date 05/09/2015
 */
@@ -29,6 +37,11 @@ public:
   StructureFactorCalculatorSummation();
   StructureFactor getF(const Kernel::V3D &hkl) const override;
 
+  std::vector<StructureFactor>
+  getFs(const std::vector<Kernel::V3D> &hkls) const override;
+  std::vector<double>
+  getFsSquared(const std::vector<Kernel::V3D> &hkls) const override;
+
 protected:
   void
   crystalStructureSetHook(const CrystalStructure &crystalStructure) override;
@@ -37,6 +50,27 @@ protected:
   std::string getV3DasString(const Kernel::V3D &point) const;
 
   CompositeBraggScatterer_sptr m_unitCellScatterers;
+
+private:
+  bool updateUnitCellAtoms(const CrystalStructure &crystalStructure);
+  size_t getDisplacementIndex(double u, const Kernel::DblMatrix &b);
+  StructureFactor sumUnitCellAtoms(const Kernel::V3D &hkl,
+                                   std::vector<double> &dStarSquared,
+                                   std::vector<double> &debyeWaller) const;
+
+  /// True if the structure factors are summed from the atom arrays
+  bool m_useUnitCellAtoms;
+  /// Fractional coordinates of the atoms in the unit cell
+  std::vector<double> m_x, m_y, m_z;
+  /// Occupancy and coherent scattering length of each atom
+  std::vector<double> m_occupancy, m_scatteringLength;
+  /// Index of the displacement parameter and cell of each atom
+  std::vector<size_t> m_displacement;
+  /// Distinct displacement parameters and the index of their cells' B matrix
+  std::vector<double> m_u;
+  std::vector<size_t> m_uCell;
+  /// Distinct B matrices of the atoms' cells
+  std::vector<Kernel::DblMatrix> m_b;
 };
 
 using StructureFactorSummation_sptr =
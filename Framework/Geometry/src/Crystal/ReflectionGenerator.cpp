@@ -8,6 +8,7 @@
 #include "MantidGeometry/Crystal/BasicHKLFilters.h"
 #include "MantidGeometry/Crystal/HKLGenerator.h"
 #include "MantidGeometry/Crystal/StructureFactorCalculatorSummation.h"
+#include "MantidKernel/MultiThreaded.h"
 
 namespace Mantid {
 namespace Geometry {
@@ -25,6 +26,35 @@ private:
   UnitCell m_cell;
 };
 
+namespace {
+/// Returns the HKLs of the generator that are allowed by the filter, in the
+/// order of the generator. The filter is applied to the HKLs in parallel.
+std::vector<V3D> getAllowedHKLs(const HKLGenerator &generator,
+                                const HKLFilter_const_sptr &filter) {
+  std::vector<V3D> candidates;
+  candidates.reserve(generator.size());
+  std::copy(generator.begin(), generator.end(),
+            std::back_inserter(candidates));
+
+  std::vector<char> isAllowed(candidates.size());
+  const auto count = static_cast<int64_t>(candidates.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < count; ++i) {
+    isAllowed[i] = filter->isAllowed(candidates[i]);
+  }
+
+  std::vector<V3D> hkls;
+  hkls.reserve(candidates.size());
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    if (isAllowed[i]) {
+      hkls.push_back(candidates[i]);
+    }
+  }
+
+  return hkls;
+}
+} // namespace
+
 /// Constructor
 ReflectionGenerator::ReflectionGenerator(
     const CrystalStructure &crystalStructure,
@@ -84,12 +114,7 @@ std::vector<Kernel::V3D> ReflectionGenerator::getHKLs(
     filter = filter & reflectionConditionFilter;
   }
 
-  std::vector<V3D> hkls;
-  hkls.reserve(generator.size());
-
-  std::remove_copy_if(generator.begin(), generator.end(),
-                      std::back_inserter(hkls), (~filter)->fn());
-  return hkls;
+  return getAllowedHKLs(generator, filter);
 }
 
 /// Returns a list of symetrically independent HKLs within the specified
@@ -111,15 +136,14 @@ std::vector<V3D> ReflectionGenerator::getUniqueHKLs(
     filter = filter & reflectionConditionFilter;
   }
 
-  std::vector<V3D> hkls;
-  hkls.reserve(generator.size());
+  std::vector<V3D> hkls = getAllowedHKLs(generator, filter);
 
   PointGroup_sptr pg = m_crystalStructure.spaceGroup()->getPointGroup();
 
-  for (auto hkl = generator.begin(); hkl != generator.end(); ++hkl) {
-    if (filter->isAllowed(*hkl)) {
-      hkls.push_back(pg->getReflectionFamily(*hkl));
-    }
+  const auto count = static_cast<int64_t>(hkls.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < count; ++i) {
+    hkls[i] = pg->getReflectionFamily(hkls[i]);
   }
 
   std::sort(hkls.begin(), hkls.end());
@@ -6,7 +6,11 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidGeometry/Crystal/StructureFactorCalculatorSummation.h"
 #include "MantidGeometry/Crystal/BraggScattererInCrystalStructure.h"
+#include "MantidGeometry/Crystal/IsotropicAtomBraggScatterer.h"
+#include "MantidKernel/MultiThreaded.h"
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 
 namespace Mantid {
@@ -14,20 +18,91 @@ namespace Geometry {
 
 using namespace Kernel;
 
+namespace {
+/// Minimum number of reflections times atoms to sum in parallel
+constexpr size_t MIN_PARALLEL_TERMS = 10000;
+} // namespace
+
 StructureFactorCalculatorSummation::StructureFactorCalculatorSummation()
     : StructureFactorCalculator(),
-      m_unitCellScatterers(CompositeBraggScatterer::create()) {}
+      m_unitCellScatterers(CompositeBraggScatterer::create()),
+      m_useUnitCellAtoms(false) {}
 
-/// Returns the structure factor obtained from the stored scatterers.
+/// Returns the structure factor obtained from the stored atoms or scatterers.
 StructureFactor
 StructureFactorCalculatorSummation::getF(const Kernel::V3D &hkl) const {
+  if (m_useUnitCellAtoms) {
+    std::vector<double> dStarSquared, debyeWaller;
+    return sumUnitCellAtoms(hkl, dStarSquared, debyeWaller);
+  }
+
   return m_unitCellScatterers->calculateStructureFactor(hkl);
 }
 
-/// Calls updateUnitCellScatterers() to rebuild the complete list of scatterers.
+/**
+ * Returns structure factors for each HKL in the container
+ *
+ * If the unit cell consists of isotropic atoms only, the structure factors
+ * are calculated in parallel, otherwise the base class implementation is used.
+ *
+ * @param hkls :: Vector of HKLs.
+ * @return :: Vector of structure factors for the given HKLs.
+ */
+std::vector<StructureFactor> StructureFactorCalculatorSummation::getFs(
+    const std::vector<Kernel::V3D> &hkls) const {
+  if (!m_useUnitCellAtoms) {
+    return StructureFactorCalculator::getFs(hkls);
+  }
+
+  std::vector<StructureFactor> structureFactors(hkls.size());
+  const auto count = static_cast<int64_t>(hkls.size());
+  PARALLEL_FOR_IF(hkls.size() * m_x.size() >= MIN_PARALLEL_TERMS)
+  for (int64_t i = 0; i < count; ++i) {
+    std::vector<double> dStarSquared, debyeWaller;
+    structureFactors[i] = sumUnitCellAtoms(hkls[i], dStarSquared, debyeWaller);
+  }
+
+  return structureFactors;
+}
+
+/**
+ * Returns squared structure factors for each HKL in the container
+ *
+ * If the unit cell consists of isotropic atoms only, the structure factors
+ * are calculated in parallel, otherwise the base class implementation is used.
+ *
+ * @param hkls :: Vector of HKLs.
+ * @return :: Vector of squared structure factors for the given HKLs.
+ */
+std::vector<double> StructureFactorCalculatorSummation::getFsSquared(
+    const std::vector<Kernel::V3D> &hkls) const {
+  if (!m_useUnitCellAtoms) {
+    return StructureFactorCalculator::getFsSquared(hkls);
+  }
+
+  std::vector<double> fSquareds(hkls.size());
+  const auto count = static_cast<int64_t>(hkls.size());
+  PARALLEL_FOR_IF(hkls.size() * m_x.size() >= MIN_PARALLEL_TERMS)
+  for (int64_t i = 0; i < count; ++i) {
+    std::vector<double> dStarSquared, debyeWaller;
+    const StructureFactor sf =
+        sumUnitCellAtoms(hkls[i], dStarSquared, debyeWaller);
+    fSquareds[i] = sf.real() * sf.real() + sf.imag() * sf.imag();
+  }
+
+  return fSquareds;
+}
+
+/// Rebuilds the atoms of the unit cell, or the complete list of scatterers
+/// if the structure contains other scatterers than isotropic atoms.
 void StructureFactorCalculatorSummation::crystalStructureSetHook(
     const CrystalStructure &crystalStructure) {
-  updateUnitCellScatterers(crystalStructure);
+  m_useUnitCellAtoms = updateUnitCellAtoms(crystalStructure);
+  if (m_useUnitCellAtoms) {
+    m_unitCellScatterers->removeAllScatterers();
+  } else {
+    updateUnitCellScatterers(crystalStructure);
+  }
 }
 
 /**
@@ -74,6 +149,136 @@ void StructureFactorCalculatorSummation::updateUnitCellScatterers(
   }
 }
 
+/**
+ * Rebuilds the arrays of atoms in the unit cell
+ *
+ * This generates the same atoms as updateUnitCellScatterers(), in the same
+ * order, but stores their properties in arrays. That is only possible if
+ * all scatterers in the asymmetric unit are IsotropicAtomBraggScatterers.
+ *
+ * @param crystalStructure :: CrystalStructure for structure factor calculation.
+ * @return :: False if the scatterers cannot be stored as atoms.
+ */
+bool StructureFactorCalculatorSummation::updateUnitCellAtoms(
+    const CrystalStructure &crystalStructure) {
+  m_x.clear();
+  m_y.clear();
+  m_z.clear();
+  m_occupancy.clear();
+  m_scatteringLength.clear();
+  m_displacement.clear();
+  m_u.clear();
+  m_uCell.clear();
+  m_b.clear();
+
+  CompositeBraggScatterer_sptr scatterersInAsymmetricUnit =
+      crystalStructure.getScatterers();
+  SpaceGroup_const_sptr spaceGroup = crystalStructure.spaceGroup();
+
+  std::vector<IsotropicAtomBraggScatterer_sptr> atoms;
+  for (size_t i = 0; i < scatterersInAsymmetricUnit->nScatterers(); ++i) {
+    BraggScatterer_sptr scatterer = scatterersInAsymmetricUnit->getScatterer(i);
+    if (!boost::dynamic_pointer_cast<BraggScattererInCrystalStructure>(
+            scatterer)) {
+      continue;
+    }
+
+    IsotropicAtomBraggScatterer_sptr atom =
+        boost::dynamic_pointer_cast<IsotropicAtomBraggScatterer>(scatterer);
+    if (!atom) {
+      return false;
+    }
+    atoms.push_back(atom);
+  }
+
+  if (!spaceGroup) {
+    return true;
+  }
+
+  for (const auto &atom : atoms) {
+    const size_t displacement =
+        getDisplacementIndex(atom->getU(), atom->getCell().getB());
+    const double occupancy = atom->getOccupancy();
+    const double scatteringLength =
+        atom->getNeutronAtom().coh_scatt_length_real;
+
+    for (const auto &position :
+         spaceGroup->getEquivalentPositions(atom->getPosition())) {
+      m_x.push_back(position.X());
+      m_y.push_back(position.Y());
+      m_z.push_back(position.Z());
+      m_occupancy.push_back(occupancy);
+      m_scatteringLength.push_back(scatteringLength);
+      m_displacement.push_back(displacement);
+    }
+  }
+
+  return true;
+}
+
+/// Returns the index of a displacement parameter with the B matrix of its
+/// cell in m_u, adding them if they are not stored yet.
+size_t StructureFactorCalculatorSummation::getDisplacementIndex(
+    double u, const Kernel::DblMatrix &b) {
+  auto cell = std::find_if(m_b.cbegin(), m_b.cend(),
+                           [&b](const Kernel::DblMatrix &existing) {
+                             return existing.getVector() == b.getVector();
+                           });
+  const auto cellIndex = static_cast<size_t>(std::distance(m_b.cbegin(), cell));
+  if (cell == m_b.cend()) {
+    m_b.push_back(b);
+  }
+
+  for (size_t i = 0; i < m_u.size(); ++i) {
+    if (m_u[i] == u && m_uCell[i] == cellIndex) {
+      return i;
+    }
+  }
+  m_u.push_back(u);
+  m_uCell.push_back(cellIndex);
+
+  return m_u.size() - 1;
+}
+
+/**
+ * Sums the contributions of the atoms in the unit cell
+ *
+ * The Debye-Waller factor is calculated once for each distinct displacement
+ * parameter, the sum itself runs over plain arrays. The arithmetic is the
+ * same as in IsotropicAtomBraggScatterer::calculateStructureFactor().
+ *
+ * @param hkl :: HKL for which the structure factor should be calculated
+ * @param dStarSquared :: Buffer for the squared reciprocal lengths of hkl
+ * @param debyeWaller :: Buffer for the Debye-Waller factors
+ * @return Structure factor (complex).
+ */
+StructureFactor StructureFactorCalculatorSummation::sumUnitCellAtoms(
+    const V3D &hkl, std::vector<double> &dStarSquared,
+    std::vector<double> &debyeWaller) const {
+  dStarSquared.resize(m_b.size());
+  for (size_t i = 0; i < m_b.size(); ++i) {
+    dStarSquared[i] = (m_b[i] * hkl).norm2();
+  }
+  debyeWaller.resize(m_u.size());
+  for (size_t i = 0; i < m_u.size(); ++i) {
+    debyeWaller[i] =
+        exp(-2.0 * M_PI * M_PI * m_u[i] * dStarSquared[m_uCell[i]]);
+  }
+
+  const double h = hkl.X();
+  const double k = hkl.Y();
+  const double l = hkl.Z();
+  StructureFactor sum(0., 0.);
+  for (size_t i = 0; i < m_x.size(); ++i) {
+    const double amplitude =
+        m_occupancy[i] * debyeWaller[m_displacement[i]] * m_scatteringLength[i];
+    const double phase = 2.0 * M_PI * (m_x[i] * h + m_y[i] * k + m_z[i] * l);
+    sum += amplitude * StructureFactor(cos(phase), sin(phase));
+  }
+
+  return sum;
+}
+
 /// Return V3D as string without losing precision.
 std::string
 StructureFactorCalculatorSummation::getV3DasString(const V3D &point) const {
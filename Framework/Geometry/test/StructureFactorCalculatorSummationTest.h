@@ -12,8 +12,12 @@
 #include "MantidGeometry/Crystal/StructureFactorCalculatorSummation.h"
 
 #include "MantidGeometry/Crystal/BraggScattererFactory.h"
+#include "MantidGeometry/Crystal/BraggScattererInCrystalStructure.h"
+#include "MantidGeometry/Crystal/HKLGenerator.h"
 #include "MantidGeometry/Crystal/SpaceGroupFactory.h"
 
+#include <iomanip>
+
 using namespace Mantid::Geometry;
 using namespace Mantid::Kernel;
 
@@ -64,7 +68,64 @@ public:
     TS_ASSERT_LESS_THAN(calculator->getFSquared(V3D(2, 2, 2)), 1e-9);
   }
 
+  void testAtomsGiveSameStructureFactorsAsScatterers() {
+    CrystalStructure structure(
+        "5.43 5.43 5.43", "F d -3 m",
+        "Si 0 0 0 1.0 0.05; O 0.1 0.2 0.3 0.5 0.02; Al 0.1 0.1 0.1 1.0 0.05");
+
+    StructureFactorCalculatorSummation calculator;
+    calculator.setCrystalStructure(structure);
+
+    // Enough reflections and atoms to be summed in parallel
+    HKLGenerator generator(structure.cell(), 1.0);
+    std::vector<V3D> hkls(generator.begin(), generator.end());
+
+    std::vector<BraggScatterer_sptr> scatterers =
+        getUnitCellScatterers(structure);
+
+    std::vector<StructureFactor> fs = calculator.getFs(hkls);
+    std::vector<double> fSquareds = calculator.getFsSquared(hkls);
+    TS_ASSERT_EQUALS(fs.size(), hkls.size());
+    TS_ASSERT_EQUALS(fSquareds.size(), hkls.size());
+
+    for (size_t i = 0; i < hkls.size(); ++i) {
+      StructureFactor expected(0., 0.);
+      for (const auto &scatterer : scatterers) {
+        expected += scatterer->calculateStructureFactor(hkls[i]);
+      }
+
+      TS_ASSERT_DELTA(fs[i].real(), expected.real(), 1e-10);
+      TS_ASSERT_DELTA(fs[i].imag(), expected.imag(), 1e-10);
+      TS_ASSERT_DELTA(fSquareds[i], std::norm(expected), 1e-8);
+      TS_ASSERT_EQUALS(calculator.getF(hkls[i]), fs[i]);
+    }
+  }
+
 private:
+  std::vector<BraggScatterer_sptr>
+  getUnitCellScatterers(const CrystalStructure &structure) {
+    CompositeBraggScatterer_sptr asymmetricUnit = structure.getScatterers();
+    SpaceGroup_const_sptr spaceGroup = structure.spaceGroup();
+
+    std::vector<BraggScatterer_sptr> scatterers;
+    for (size_t i = 0; i < asymmetricUnit->nScatterers(); ++i) {
+      auto scatterer =
+          boost::dynamic_pointer_cast<BraggScattererInCrystalStructure>(
+              asymmetricUnit->getScatterer(i));
+      for (const auto &position :
+           spaceGroup->getEquivalentPositions(scatterer->getPosition())) {
+        std::ostringstream positionString;
+        positionString << std::setprecision(17) << position;
+
+        BraggScatterer_sptr clone = scatterer->clone();
+        clone->setProperty("Position", positionString.str());
+        scatterers.push_back(clone);
+      }
+    }
+
+    return scatterers;
+  }
+
   CrystalStructure getCrystalStructure() {
     CompositeBraggScatterer_sptr scatterers = CompositeBraggScatterer::create();
     scatterers->addScatterer(BraggScattererFactory::Instance().createScatterer(
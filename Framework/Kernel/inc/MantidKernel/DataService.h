@@ -21,6 +21,7 @@
 #include <Poco/NotificationCenter.h>
 
 #include <mutex>
+#include <shared_mutex>
 
 #ifdef _WIN32
 #define strcasecmp _stricmp
@@ -208,7 +209,7 @@ public:
     bool success = false;
     {
       // Make DataService access thread-safe
-      std::lock_guard<std::recursive_mutex> lock(m_mutex);
+      std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
       // At the moment, you can't overwrite an object (i.e. pass in a name
       // that's already in the map with a pointer to a different object).
       // Also, there's nothing to stop the same object from being added
@@ -239,19 +240,22 @@ public:
     checkForNullPointer(Tobject);
 
     // Make DataService access thread-safe
-    std::unique_lock<std::recursive_mutex> lock(m_mutex);
+    std::unique_lock<std::shared_timed_mutex> lock(m_mutex);
 
     // find if the Tobject already exists
     auto it = datamap.find(name);
     if (it != datamap.end()) {
+      auto oldObject = it->second;
       lock.unlock();
       g_log.debug("Data Object '" + name + "' replaced in data service.\n");
 
       notificationCenter.postNotification(
-          new BeforeReplaceNotification(name, it->second, Tobject));
+          new BeforeReplaceNotification(name, oldObject, Tobject));
 
+      // Look the name up again, other threads may have modified the map
+      // while the observers were running
       lock.lock();
-      it->second = Tobject;
+      datamap[name] = Tobject;
       lock.unlock();
 
       notificationCenter.postNotification(
@@ -268,7 +272,7 @@ public:
    * @param name :: name of the object */
   void remove(const std::string &name) {
     // Make DataService access thread-safe
-    std::unique_lock<std::recursive_mutex> lock(m_mutex);
+    std::unique_lock<std::shared_timed_mutex> lock(m_mutex);
 
     auto it = datamap.find(name);
     if (it == datamap.end()) {
@@ -305,7 +309,7 @@ public:
     }
 
     // Make DataService access thread-safe
-    std::unique_lock<std::recursive_mutex> lock(m_mutex);
+    std::unique_lock<std::shared_timed_mutex> lock(m_mutex);
 
     auto existingNameIter = datamap.find(oldName);
     if (existingNameIter == datamap.end()) {
@@ -314,34 +318,35 @@ public:
       return;
     }
 
-    auto existingNameObject = std::move(existingNameIter->second);
+    // If we are overriding send a notification for observers. Observers may
+    // use the service so the lock is released while they run.
     auto targetNameIter = datamap.find(newName);
-
-    // If we are overriding send a notification for observers
-    if (targetNameIter != datamap.end()) {
+    const bool replacing =
+        targetNameIter != datamap.end() && targetNameIter != existingNameIter;
+    if (replacing) {
       auto targetNameObject = targetNameIter->second;
+      auto existingNameObject = existingNameIter->second;
+      lock.unlock();
       // As we are renaming the existing name turns into the new name
       notificationCenter.postNotification(new BeforeReplaceNotification(
           newName, targetNameObject, existingNameObject));
+      lock.lock();
+      existingNameIter = datamap.find(oldName);
+      if (existingNameIter == datamap.end()) {
+        lock.unlock();
+        g_log.warning(" rename '" + oldName + "' was removed while renaming");
+        return;
+      }
     }
 
+    auto renamedObject = std::move(existingNameIter->second);
     datamap.erase(existingNameIter);
+    datamap[newName] = renamedObject;
+    lock.unlock();
 
-    if (targetNameIter != datamap.end()) {
-      targetNameIter->second = std::move(existingNameObject);
+    if (replacing)
       notificationCenter.postNotification(
-          new AfterReplaceNotification(newName, targetNameIter->second));
-    } else {
-      if (!(datamap.emplace(newName, std::move(existingNameObject)).second)) {
-        // should never happen
-        lock.unlock();
-        std::string error =
-            " add : Unable to insert Data Object : '" + newName + "'";
-        g_log.error(error);
-        throw std::runtime_error(error);
-      }
-    }
-    lock.unlock();
+          new AfterReplaceNotification(newName, renamedObject));
     g_log.debug("Data Object '" + oldName + "' renamed to '" + newName + "'");
     notificationCenter.postNotification(
         new RenameNotification(oldName, newName));
@@ -352,7 +357,7 @@ public:
   void clear() {
     {
       // Make DataService access thread-safe
-      std::lock_guard<std::recursive_mutex> lock(m_mutex);
+      std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
       datamap.clear();
     }
     notificationCenter.postNotification(new ClearNotification());
@@ -367,7 +372,7 @@ public:
    * @param name :: name of the object */
   boost::shared_ptr<T> retrieve(const std::string &name) const {
     // Make DataService access thread-safe
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    std::shared_lock<std::shared_timed_mutex> _lock(m_mutex);
 
     auto it = datamap.find(name);
     if (it != datamap.end()) {
@@ -392,14 +397,14 @@ public:
   /// Check to see if a data object exists in the store
   bool doesExist(const std::string &name) const {
     // Make DataService access thread-safe
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    std::shared_lock<std::shared_timed_mutex> _lock(m_mutex);
     auto it = datamap.find(name);
     return it != datamap.end();
   }
 
   /// Return the number of objects stored by the data service
   size_t size() const {
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    std::shared_lock<std::shared_timed_mutex> _lock(m_mutex);
 
     if (showingHiddenObjects()) {
       return datamap.size();
@@ -439,14 +444,14 @@ public:
     // Use the scoping of an if to handle our lock for duration
     if (hiddenState == DataServiceHidden::Include) {
       // Getting hidden items
-      std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+      std::shared_lock<std::shared_timed_mutex> _lock(m_mutex);
       foundNames.reserve(datamap.size());
       for (const auto &item : datamap) {
         foundNames.push_back(item.first);
       }
       // Lock released at end of scope here
     } else {
-      std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+      std::shared_lock<std::shared_timed_mutex> _lock(m_mutex);
       foundNames.reserve(datamap.size());
       for (const auto &item : datamap) {
         if (!isHiddenDataServiceObject(item.first)) {
@@ -468,7 +473,7 @@ public:
   /// Get a vector of the pointers to the data objects stored by the service
   std::vector<boost::shared_ptr<T>>
   getObjects(DataServiceHidden includeHidden = DataServiceHidden::Auto) const {
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    std::shared_lock<std::shared_timed_mutex> _lock(m_mutex);
 
     const bool alwaysIncludeHidden =
         includeHidden == DataServiceHidden::Include;
@@ -536,8 +541,9 @@ private:
   const std::string svcName;
   /// Map of objects in the data service
   svcmap datamap;
-  /// Recursive mutex to avoid simultaneous access or notifications
-  mutable std::recursive_mutex m_mutex;
+  /// Guards the map. Lookups share the lock, modifications hold it
+  /// exclusively. Notifications are always posted with the lock released.
+  mutable std::shared_timed_mutex m_mutex;
   /// Logger for this DataService
   Logger g_log;
 }; // End Class Data service
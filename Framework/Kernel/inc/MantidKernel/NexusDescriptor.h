@@ -9,10 +9,8 @@
 
 #include "MantidKernel/DllConfig.h"
 
-#include <map>
 #include <memory>
 #include <string>
-#include <unordered_set>
 #include <utility>
 
 namespace NeXus {
@@ -26,8 +24,13 @@ namespace Kernel {
     Defines a wrapper around a file whose internal structure can be accessed
    using the NeXus API
 
-    On construction the simple details about the layout of the file are cached
-   for faster querying later.
+    On construction only the root of the file is read. The rest of the
+   layout is walked lazily, one group at a time, as queries need it and the
+   walked layout is cached per file path and modification time. Later
+   descriptors of an unchanged file, e.g. the one the chosen loader creates,
+   reuse it without walking the file again. If the
+   nexusdescriptor.cache.directory key is set, fully walked layouts are also
+   written there and reused across sessions.
  */
 class MANTID_KERNEL_DLL NexusDescriptor {
 public:
@@ -45,6 +48,8 @@ public:
   /// Returns true if the file is considered to store data in a hierarchy
   static bool isHDF(const std::string &filename,
                     const Version version = AnyVersion);
+  /// Forget the cached layout of all files
+  static void clearCache();
 
 public:
   /// Constructor accepting a filename
@@ -72,11 +77,8 @@ public:
    * @returns A reference to a const string containing the file extension
    */
   inline const std::string &extension() const { return m_extension; }
-  /**
-   * Access the open NeXus File object
-   * @returns A reference to the open ::NeXus file object
-   */
-  inline ::NeXus::File &data() { return *m_file; }
+  /// Access the open NeXus File object
+  ::NeXus::File &data();
 
   /// Returns the name & type of the first entry in the file
   const std::pair<std::string, std::string> &firstEntryNameType() const;
@@ -91,27 +93,31 @@ public:
   /// Query if a given type exists somewhere in the file
   bool classTypeExists(const std::string &classType) const;
 
+  /// The layout of a file, walked so far
+  struct Layout;
+
 private:
   /// Initialize object with filename
   void initialize(const std::string &filename);
-  /// Walk the tree and cache the structure
-  void walkFile(::NeXus::File &file, const std::string &rootPath,
-                const std::string &className,
-                std::map<std::string, std::string> &pmap, int level);
+  /// Read the entries of a group into the layout
+  void walkGroup(Layout &layout, const std::string &path) const;
+  /// Walk the groups above a path
+  void walkParents(Layout &layout, const std::string &path) const;
+  /// Walk groups until the predicate is true or the whole file is walked
+  template <typename Predicate>
+  bool walkUntil(Layout &layout, Predicate found) const;
 
   /// Full filename
   std::string m_filename;
   /// Extension
   std::string m_extension;
-  /// First entry name/type
-  std::pair<std::string, std::string> m_firstEntryNameType;
-  /// Root attributes
-  std::unordered_set<std::string> m_rootAttrs;
-  /// Map of full path strings to types. Can check if path exists quickly
-  std::map<std::string, std::string> m_pathsToTypes;
+  /// The layout of the file, possibly shared with other descriptors
+  std::shared_ptr<Layout> m_layout;
 
   /// Open NeXus handle
   std::unique_ptr<::NeXus::File> m_file;
+  /// Handle used to walk the file, kept apart so data() is not moved
+  mutable std::unique_ptr<::NeXus::File> m_walker;
 };
 
 } // namespace Kernel
@@ -5,6 +5,8 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidKernel/NexusDescriptor.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Logger.h"
 
 // clang-format off
 #include <nexus/NeXusFile.hpp>
@@ -15,10 +17,49 @@
 #include <Poco/Path.h>
 
 #include <cstring>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <unordered_set>
 
 namespace Mantid {
 namespace Kernel {
+
+/// The layout of a file as far as it has been walked. Shared between the
+/// descriptors of a file, so every access must hold the mutex.
+struct NexusDescriptor::Layout {
+  std::mutex mutex;
+  /// Full filename, modification time and size of the file walked
+  std::string filename;
+  Poco::Timestamp::TimeVal modified{0};
+  Poco::File::FileSize size{0};
+  /// First entry name/type
+  std::pair<std::string, std::string> firstEntryNameType;
+  /// Root attributes
+  std::unordered_set<std::string> rootAttrs;
+  /// Map of full path strings to types. Can check if path exists quickly
+  std::map<std::string, std::string> pathsToTypes;
+  /// All the types in pathsToTypes
+  std::unordered_set<std::string> types;
+  /// Groups whose entries have not been read yet
+  std::unordered_set<std::string> unwalked;
+  /// The order in which to walk the groups, breadth first. May contain
+  /// groups that have already been walked.
+  std::deque<std::string> walkOrder;
+  /// True once a complete layout has been written to the disk cache
+  bool saved{false};
+
+  void addPath(const std::string &path, const std::string &type) {
+    pathsToTypes.emplace(path, type);
+    types.insert(type);
+  }
+};
+
 //---------------------------------------------------------------------------------------------------------------------------
 // static NexusDescriptor constants
 //---------------------------------------------------------------------------------------------------------------------------
@@ -35,6 +76,125 @@ const unsigned char NexusDescriptor::HDF5Signature[8] = {
     137, 'H', 'D', 'F', '\r', '\n', '\032', '\n'};
 
 namespace {
+/// static logger
+Logger g_log("NexusDescriptor");
+
+/// Configuration key for the directory of the on-disk layout cache
+const std::string CACHE_DIRECTORY_KEY("nexusdescriptor.cache.directory");
+/// The number of file layouts kept in memory
+constexpr size_t MAX_CACHED_LAYOUTS = 32;
+
+/// Layouts of recently described files, keyed by filename
+std::map<std::string, std::shared_ptr<NexusDescriptor::Layout>> g_layouts;
+/// Guards g_layouts
+std::mutex g_layoutsMutex;
+
+/// Returns the cached layout of the file if it has not changed since
+std::shared_ptr<NexusDescriptor::Layout>
+cachedLayout(const std::string &filename, Poco::Timestamp::TimeVal modified,
+             Poco::File::FileSize size) {
+  std::lock_guard<std::mutex> lock(g_layoutsMutex);
+  auto it = g_layouts.find(filename);
+  if (it == g_layouts.end())
+    return nullptr;
+  if (it->second->modified != modified || it->second->size != size) {
+    g_layouts.erase(it);
+    return nullptr;
+  }
+  return it->second;
+}
+
+/// Keep a layout for later descriptors of the same file
+void cacheLayout(const std::shared_ptr<NexusDescriptor::Layout> &layout) {
+  std::lock_guard<std::mutex> lock(g_layoutsMutex);
+  if (g_layouts.size() >= MAX_CACHED_LAYOUTS &&
+      g_layouts.count(layout->filename) == 0)
+    g_layouts.erase(g_layouts.begin());
+  g_layouts[layout->filename] = layout;
+}
+
+/// @returns The path of the file in the disk cache for the given file, or an
+/// empty string if there is no disk cache
+std::string diskCachePath(const std::string &filename) {
+  const auto directory =
+      ConfigService::Instance().getString(CACHE_DIRECTORY_KEY);
+  if (directory.empty())
+    return "";
+  std::ostringstream name;
+  name << std::hex << std::hash<std::string>()(filename) << ".nxlayout";
+  return Poco::Path(directory, name.str()).toString();
+}
+
+/**
+ * Write a completely walked layout to the disk cache, if there is one. Each
+ * line holds one item, with a tab between names and types.
+ * @param layout A layout that has been walked completely
+ */
+void saveLayout(NexusDescriptor::Layout &layout) {
+  if (layout.saved)
+    return;
+  layout.saved = true;
+  const auto cachePath = diskCachePath(layout.filename);
+  if (cachePath.empty())
+    return;
+  try {
+    Poco::File(Poco::Path(cachePath).parent()).createDirectories();
+    std::ofstream out(cachePath, std::ios::trunc);
+    out << layout.filename << '\n'
+        << layout.modified << ' ' << layout.size << '\n'
+        << layout.firstEntryNameType.first << '\t'
+        << layout.firstEntryNameType.second << '\n'
+        << layout.rootAttrs.size() << '\n';
+    for (const auto &attr : layout.rootAttrs)
+      out << attr << '\n';
+    for (const auto &pathType : layout.pathsToTypes)
+      out << pathType.first << '\t' << pathType.second << '\n';
+  } catch (std::exception &e) {
+    g_log.debug() << "Unable to cache the layout of " << layout.filename
+                  << " in " << cachePath << ": " << e.what() << '\n';
+  }
+}
+
+/// Read the layout of a file from the disk cache
+/// @returns The layout, or nullptr if it is not cached or the file changed
+std::shared_ptr<NexusDescriptor::Layout>
+loadLayout(const std::string &filename, Poco::Timestamp::TimeVal modified,
+           Poco::File::FileSize size) {
+  const auto cachePath = diskCachePath(filename);
+  if (cachePath.empty())
+    return nullptr;
+  std::ifstream in(cachePath);
+  std::string cachedFilename;
+  Poco::Timestamp::TimeVal cachedModified(0);
+  Poco::File::FileSize cachedSize(0);
+  if (!std::getline(in, cachedFilename) || cachedFilename != filename ||
+      !(in >> cachedModified >> cachedSize) || cachedModified != modified ||
+      cachedSize != size)
+    return nullptr;
+
+  auto layout = std::make_shared<NexusDescriptor::Layout>();
+  layout->filename = filename;
+  layout->modified = modified;
+  layout->size = size;
+  layout->saved = true;
+  size_t nAttrs(0);
+  in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  std::getline(in, layout->firstEntryNameType.first, '\t');
+  std::getline(in, layout->firstEntryNameType.second);
+  in >> nAttrs;
+  in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  std::string line;
+  for (size_t i = 0; i < nAttrs && std::getline(in, line); ++i)
+    layout->rootAttrs.insert(line);
+  while (std::getline(in, line)) {
+    const auto tab = line.find('\t');
+    if (tab == std::string::npos)
+      return nullptr;
+    layout->addPath(line.substr(0, tab), line.substr(tab + 1));
+  }
+  return in.eof() ? layout : nullptr;
+}
+
 //---------------------------------------------------------------------------------------------------------------------------
 // Anonymous helper methods to use isHDF methods to use an open file handle
 //---------------------------------------------------------------------------------------------------------------------------
@@ -109,6 +269,15 @@ bool NexusDescriptor::isHDF(const std::string &filename,
   return result;
 }
 
+/**
+ * Forget the cached layouts of all files. Descriptors that already exist keep
+ * theirs.
+ */
+void NexusDescriptor::clearCache() {
+  std::lock_guard<std::mutex> lock(g_layoutsMutex);
+  g_layouts.clear();
+}
+
 //---------------------------------------------------------------------------------------------------------------------------
 // NexusDescriptor public methods
 //---------------------------------------------------------------------------------------------------------------------------
@@ -121,8 +290,8 @@ bool NexusDescriptor::isHDF(const std::string &filename,
  * file
  */
 NexusDescriptor::NexusDescriptor(const std::string &filename)
-    : m_filename(), m_extension(), m_firstEntryNameType(), m_rootAttrs(),
-      m_pathsToTypes(), m_file(nullptr) {
+    : m_filename(), m_extension(), m_layout(), m_file(nullptr),
+      m_walker(nullptr) {
   if (filename.empty()) {
     throw std::invalid_argument("NexusDescriptor() - Empty filename '" +
                                 filename + "'");
@@ -144,10 +313,21 @@ NexusDescriptor::NexusDescriptor(const std::string &filename)
  */
 NexusDescriptor::~NexusDescriptor() {}
 
+/**
+ * Access the open NeXus File object. The file is opened on first use.
+ * @returns A reference to the open ::NeXus file object
+ */
+::NeXus::File &NexusDescriptor::data() {
+  if (!m_file)
+    m_file = std::make_unique<::NeXus::File>(m_filename);
+  return *m_file;
+}
+
 /// Returns the name & type of the first entry in the file
 const std::pair<std::string, std::string> &
 NexusDescriptor::firstEntryNameType() const {
-  return m_firstEntryNameType;
+  // The root is always walked and this never changes afterwards
+  return m_layout->firstEntryNameType;
 }
 
 /**
@@ -155,19 +335,24 @@ NexusDescriptor::firstEntryNameType() const {
  * @return True if the attribute exists, false otherwise
  */
 bool NexusDescriptor::hasRootAttr(const std::string &name) const {
-  return (m_rootAttrs.count(name) == 1);
+  std::lock_guard<std::mutex> lock(m_layout->mutex);
+  return (m_layout->rootAttrs.count(name) == 1);
 }
 
 /**
+ * Only the groups above the path are walked
  * @param path A string giving a path using UNIX-style path separators (/), e.g.
  * /raw_data_1, /entry/bank1
  * @return True if the path exists in the file, false otherwise
  */
 bool NexusDescriptor::pathExists(const std::string &path) const {
-  return (m_pathsToTypes.find(path) != m_pathsToTypes.end());
+  std::lock_guard<std::mutex> lock(m_layout->mutex);
+  walkParents(*m_layout, path);
+  return (m_layout->pathsToTypes.find(path) != m_layout->pathsToTypes.end());
 }
 
 /**
+ * Only the groups above the path are walked
  * @param path A string giving a path using UNIX-style path separators (/), e.g.
  * /raw_data_1, /entry/bank1
  * @param type A string specifying the required type
@@ -175,21 +360,26 @@ bool NexusDescriptor::pathExists(const std::string &path) const {
  */
 bool NexusDescriptor::pathOfTypeExists(const std::string &path,
                                        const std::string &type) const {
-  auto it = m_pathsToTypes.find(path);
-  if (it != m_pathsToTypes.end()) {
+  std::lock_guard<std::mutex> lock(m_layout->mutex);
+  walkParents(*m_layout, path);
+  auto it = m_layout->pathsToTypes.find(path);
+  if (it != m_layout->pathsToTypes.end()) {
     return (it->second == type);
   } else
     return false;
 }
 
 /**
+ * This walks the whole file
  * @param type A string specifying the required type
  * @return path A string giving a path using UNIX-style path separators (/),
  * e.g. /raw_data_1, /entry/bank1
  */
 std::string NexusDescriptor::pathOfType(const std::string &type) const {
-  auto iend = m_pathsToTypes.end();
-  for (auto it = m_pathsToTypes.begin(); it != iend; ++it) {
+  std::lock_guard<std::mutex> lock(m_layout->mutex);
+  walkUntil(*m_layout, [] { return false; });
+  auto iend = m_layout->pathsToTypes.end();
+  for (auto it = m_layout->pathsToTypes.begin(); it != iend; ++it) {
     if (type == it->second)
       return it->first;
   }
@@ -197,16 +387,15 @@ std::string NexusDescriptor::pathOfType(const std::string &type) const {
 }
 
 /**
+ * The file is walked until the type is found
  * @param classType A string name giving a class type
  * @return True if the type exists in the file, false otherwise
  */
 bool NexusDescriptor::classTypeExists(const std::string &classType) const {
-  auto iend = m_pathsToTypes.end();
-  for (auto it = m_pathsToTypes.begin(); it != iend; ++it) {
-    if (classType == it->second)
-      return true;
-  }
-  return false;
+  std::lock_guard<std::mutex> lock(m_layout->mutex);
+  const auto &types = m_layout->types;
+  return walkUntil(*m_layout,
+                   [&types, &classType] { return types.count(classType) > 0; });
 }
 
 //---------------------------------------------------------------------------------------------------------------------------
@@ -214,39 +403,48 @@ bool NexusDescriptor::classTypeExists(const std::string &classType) const {
 //---------------------------------------------------------------------------------------------------------------------------
 
 /**
- * Creates the internal cached structure of the file as a tree of nodes
+ * Reuses the cached layout of the file if it has not changed, otherwise reads
+ * the root of the file
  */
 void NexusDescriptor::initialize(const std::string &filename) {
   m_filename = filename;
   m_extension = "." + Poco::Path(filename).getExtension();
 
-  m_file = std::make_unique<::NeXus::File>(this->filename());
+  const Poco::File file(filename);
+  const auto modified = file.getLastModified().epochMicroseconds();
+  const auto size = file.getSize();
+  m_layout = cachedLayout(filename, modified, size);
+  if (m_layout)
+    return;
 
-  m_file->openPath("/");
-  m_rootAttrs.clear();
-  m_pathsToTypes.clear();
-  walkFile(*m_file, "", "", m_pathsToTypes, 0);
+  // Opening the file checks that it is HDF
+  m_walker = std::make_unique<::NeXus::File>(this->filename());
+  m_layout = loadLayout(filename, modified, size);
+  if (!m_layout) {
+    m_layout = std::make_shared<Layout>();
+    m_layout->filename = filename;
+    m_layout->modified = modified;
+    m_layout->size = size;
+    walkGroup(*m_layout, "");
+  }
+  cacheLayout(m_layout);
 }
 
 /**
- * Cache the structure in the given maps
- * @param file An open NeXus File object
- * @param rootPath The current path that is open in the file
- * @param className The class of the current open path
- * @param pmap [Out] An output map filled with mappings of path->type
- * @param level An integer defining the current level in the file
+ * Cache the entries of a group in the layout. Subgroups are queued to be
+ * walked later.
+ * @param layout The layout to add to. The caller must hold its mutex.
+ * @param path The path of the group, empty for the root
  */
-void NexusDescriptor::walkFile(::NeXus::File &file, const std::string &rootPath,
-                               const std::string &className,
-                               std::map<std::string, std::string> &pmap,
-                               int level) {
-  if (!rootPath.empty()) {
-    pmap.emplace(rootPath, className);
-  }
-  if (level == 0) {
+void NexusDescriptor::walkGroup(Layout &layout, const std::string &path) const {
+  if (!m_walker)
+    m_walker = std::make_unique<::NeXus::File>(m_filename);
+  auto &file = *m_walker;
+  file.openPath(path.empty() ? "/" : path);
+  if (path.empty()) {
     auto attrInfos = file.getAttrInfos();
     for (auto &attrInfo : attrInfos) {
-      m_rootAttrs.insert(attrInfo.name);
+      layout.rootAttrs.insert(attrInfo.name);
     }
   }
 
@@ -256,19 +454,59 @@ void NexusDescriptor::walkFile(::NeXus::File &file, const std::string &rootPath,
     const std::string &entryName = it->first;
     const std::string &entryClass = it->second;
     const std::string entryPath =
-        std::string(rootPath).append("/").append(entryName);
+        std::string(path).append("/").append(entryName);
     if (entryClass == "SDS" || entryClass == "ILL_data_scan_vars") {
-      pmap.emplace(entryPath, entryClass);
+      layout.addPath(entryPath, entryClass);
     } else if (entryClass == "CDF0.0") {
       // Do nothing with this
     } else {
-      if (level == 0)
-        m_firstEntryNameType = (*it); // copy first entry name & type
-      file.openGroup(entryName, entryClass);
-      walkFile(file, entryPath, entryClass, pmap, level + 1);
+      if (path.empty())
+        layout.firstEntryNameType = (*it); // copy first entry name & type
+      layout.addPath(entryPath, entryClass);
+      layout.unwalked.insert(entryPath);
+      layout.walkOrder.push_back(entryPath);
+    }
+  }
+  layout.unwalked.erase(path);
+}
+
+/**
+ * Walk each group above the given path that has not been walked yet, so that
+ * the layout knows whether the path exists
+ * @param layout The layout to add to. The caller must hold its mutex.
+ * @param path A path using UNIX-style path separators
+ */
+void NexusDescriptor::walkParents(Layout &layout,
+                                  const std::string &path) const {
+  for (auto pos = path.find('/', 1); pos != std::string::npos;
+       pos = path.find('/', pos + 1)) {
+    const auto parent = path.substr(0, pos);
+    if (layout.pathsToTypes.count(parent) == 0)
+      return;
+    if (layout.unwalked.count(parent) == 1)
+      walkGroup(layout, parent);
+  }
+}
+
+/**
+ * Walk the groups breadth first until the predicate holds
+ * @param layout The layout to add to. The caller must hold its mutex.
+ * @param found Returns true when no more walking is needed
+ * @return The final value of the predicate
+ */
+template <typename Predicate>
+bool NexusDescriptor::walkUntil(Layout &layout, Predicate found) const {
+  while (!found()) {
+    if (layout.unwalked.empty()) {
+      saveLayout(layout);
+      return false;
     }
+    const auto group = layout.walkOrder.front();
+    layout.walkOrder.pop_front();
+    if (layout.unwalked.count(group) == 1)
+      walkGroup(layout, group);
   }
-  file.closeGroup();
+  return true;
 }
 
 } // namespace Kernel
@@ -13,8 +13,10 @@
 #include <boost/make_shared.hpp>
 #include <cxxtest/TestSuite.h>
 
+#include <atomic>
 #include <mutex>
 #include <sstream>
+#include <string>
 
 using namespace Mantid;
 using namespace Mantid::Kernel;
@@ -202,6 +204,42 @@ public:
                               svc.retrieve("anotherOne"));
   }
 
+  // Handler for an observer that looks up the replaced object in the service
+  void handleBeforeReplaceRetrieve(
+      const Poco::AutoPtr<FakeDataService::BeforeReplaceNotification> &nf) {
+    TS_ASSERT_EQUALS(svc.retrieve(nf->objectName()), nf->oldObject());
+    ++notificationFlag;
+  }
+
+  void test_observers_can_use_the_service_during_rename() {
+    Poco::NObserver<DataServiceTest, FakeDataService::BeforeReplaceNotification>
+        observer(*this, &DataServiceTest::handleBeforeReplaceRetrieve);
+    svc.notificationCenter.addObserver(observer);
+
+    auto one = boost::make_shared<int>(1);
+    auto two = boost::make_shared<int>(2);
+    svc.add("One", one);
+    svc.add("Two", two);
+    svc.rename("One", "Two");
+    TS_ASSERT_EQUALS(notificationFlag, 1);
+    TS_ASSERT_EQUALS(svc.retrieve("Two"), one);
+    TS_ASSERT(!svc.doesExist("One"));
+
+    svc.addOrReplace("Two", two);
+    TS_ASSERT_EQUALS(notificationFlag, 2);
+    TS_ASSERT_EQUALS(svc.retrieve("Two"), two);
+    svc.notificationCenter.removeObserver(observer);
+  }
+
+  void test_rename_changing_only_case() {
+    auto one = boost::make_shared<int>(1);
+    svc.add("one", one);
+    svc.rename("one", "One");
+    TS_ASSERT_EQUALS(svc.size(), 1);
+    TS_ASSERT_EQUALS(svc.getObjectNames(), std::vector<std::string>{"One"});
+    TS_ASSERT_EQUALS(svc.retrieve("One"), one);
+  }
+
   void handleClearNotification(
       const Poco::AutoPtr<FakeDataService::ClearNotification> &) {
     ++notificationFlag;
@@ -528,4 +566,43 @@ public:
   }
 };
 
+class DataServiceTestPerformance : public CxxTest::TestSuite {
+public:
+  static DataServiceTestPerformance *createSuite() {
+    return new DataServiceTestPerformance();
+  }
+  static void destroySuite(DataServiceTestPerformance *suite) {
+    delete suite;
+  }
+
+  void setUp() override {
+    for (size_t i = 0; i < numberOfObjects; ++i)
+      svc.add("item" + std::to_string(i),
+              boost::make_shared<int>(static_cast<int>(i)));
+  }
+
+  void tearDown() override { svc.clear(); }
+
+  void test_concurrent_readers_and_writers() {
+    // Mostly lookups, with one in fifty operations replacing an object
+    std::atomic<bool> allFound{true};
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 2000000; ++i) {
+      const int index = i % static_cast<int>(numberOfObjects);
+      const std::string name = "item" + std::to_string(index);
+      if (i % 50 == 0) {
+        svc.addOrReplace(name, boost::make_shared<int>(index));
+      } else if (!svc.doesExist(name) || *svc.retrieve(name) != index) {
+        allFound = false;
+      }
+    }
+    TS_ASSERT(allFound);
+    TS_ASSERT_EQUALS(svc.size(), numberOfObjects);
+  }
+
+private:
+  const size_t numberOfObjects = 1000;
+  FakeDataService svc;
+};
+
 #endif /* MANTID_KERNEL_DATASERVICETEST_H_ */
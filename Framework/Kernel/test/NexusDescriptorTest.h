@@ -19,6 +19,7 @@
 #include <nexus/NeXusFile.hpp>
 
 #include <cstdio>
+#include <vector>
 
 using Mantid::Kernel::NexusDescriptor;
 
@@ -173,7 +174,61 @@ public:
     TS_ASSERT(m_testHDF5->classTypeExists("NXlog"));
   }
 
+  void test_classTypeExists_Returns_False_For_Type_Not_In_File() {
+    TS_ASSERT(!m_testHDF5->classTypeExists("NXnot_a_class"));
+  }
+
+  void test_pathOfType_Returns_A_Path_Of_That_Type() {
+    const auto path = m_testHDF5->pathOfType("NXevent_data");
+    TS_ASSERT(m_testHDF5->pathOfTypeExists(path, "NXevent_data"));
+    TS_ASSERT_EQUALS("", m_testHDF5->pathOfType("NXnot_a_class"));
+  }
+
+  void test_Descriptors_Of_The_Same_File_Agree() {
+    NexusDescriptor::clearCache();
+    NexusDescriptor first(m_testHDF5Path);
+    TS_ASSERT(first.pathExists("/entry/bank1/data_x_y"));
+    NexusDescriptor second(m_testHDF5Path);
+    assertDescribesTestHDF5(second);
+  }
+
+  void test_Layout_Is_Reused_From_The_Disk_Cache() {
+    auto &config = Mantid::Kernel::ConfigService::Instance();
+    const std::string cacheKey("nexusdescriptor.cache.directory");
+    const auto oldCacheDirectory = config.getString(cacheKey);
+    Poco::Path cacheDirectory(Poco::Path::temp(), "NexusDescriptorTestCache");
+    config.setString(cacheKey, cacheDirectory.toString());
+
+    NexusDescriptor::clearCache();
+    {
+      NexusDescriptor walked(m_testHDF5Path);
+      // Walks the whole file
+      TS_ASSERT(!walked.classTypeExists("NXnot_a_class"));
+    }
+    std::vector<std::string> cached;
+    Poco::File(cacheDirectory).list(cached);
+    TS_ASSERT_EQUALS(cached.size(), 1);
+
+    NexusDescriptor::clearCache();
+    NexusDescriptor fromDisk(m_testHDF5Path);
+    assertDescribesTestHDF5(fromDisk);
+
+    config.setString(cacheKey, oldCacheDirectory);
+    Poco::File(cacheDirectory).remove(true);
+  }
+
 private:
+  void assertDescribesTestHDF5(const NexusDescriptor &descriptor) {
+    TS_ASSERT_EQUALS("entry", descriptor.firstEntryNameType().first);
+    TS_ASSERT_EQUALS("NXentry", descriptor.firstEntryNameType().second);
+    TS_ASSERT(descriptor.hasRootAttr("file_time"));
+    TS_ASSERT(descriptor.pathExists("/entry/bank1/data_x_y"));
+    TS_ASSERT(
+        descriptor.pathOfTypeExists("/entry/bank1_events", "NXevent_data"));
+    TS_ASSERT(descriptor.classTypeExists("NXlog"));
+    TS_ASSERT(!descriptor.pathExists("/raw_data_1/bank1"));
+  }
+
   std::string m_testHDF5Path;
   std::string m_testHDF4Path;
   std::string m_testNonHDFPath;
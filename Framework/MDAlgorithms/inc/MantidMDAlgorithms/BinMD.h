@@ -72,10 +72,17 @@ private:
   template <typename MDE, size_t nd>
   void binByIterating(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
 
+  /// Bin all of the leaf boxes at once into per-thread output arrays
+  template <typename MDE, size_t nd>
+  void binWithThreadAccumulators(
+      typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws,
+      const int numThreads);
+
   /// Method to bin a single MDBox
   template <typename MDE, size_t nd>
   void binMDBox(DataObjects::MDBox<MDE, nd> *box, const size_t *const chunkMin,
-                const size_t *const chunkMax);
+                const size_t *const chunkMax, signal_t *const boxSignals,
+                signal_t *const boxErrors, signal_t *const boxNumEvents);
 
   /// The output MDHistoWorkspace
   Mantid::DataObjects::MDHistoWorkspace_sptr outWS;
@@ -77,6 +77,14 @@ public:
   addEvents(std::vector<std::pair<double, Mantid::Kernel::V3D>> const &event_qs,
             bool hkl_integ);
 
+  /// Add event Q's to separate lists of events near peaks (thread-safe)
+  void
+  addEvents(std::vector<std::pair<double, Mantid::Kernel::V3D>> const &event_qs,
+            bool hkl_integ, EventListMap &event_lists) const;
+
+  /// Move lists of events collected with the thread-safe addEvents
+  void mergeEvents(EventListMap &event_lists);
+
   /// Find the net integrated intensity of a peak, using ellipsoidal volumes
   boost::shared_ptr<const Mantid::Geometry::PeakShape> ellipseIntegrateEvents(
       std::vector<Kernel::V3D> E1Vec, Mantid::Kernel::V3D const &peak_q,
@@ -157,15 +165,16 @@ private:
   static int64_t getHklMnpKey(int h, int k, int l, int m, int n, int p);
 
   /// Form a map key for the specified q_vector.
-  int64_t getHklKey(Mantid::Kernel::V3D const &q_vector);
-  int64_t getHklMnpKey(Mantid::Kernel::V3D const &q_vector);
-  int64_t getHklKey2(Mantid::Kernel::V3D const &hkl);
-  int64_t getHklMnpKey2(Mantid::Kernel::V3D const &hkl);
+  int64_t getHklKey(Mantid::Kernel::V3D const &q_vector) const;
+  int64_t getHklMnpKey(Mantid::Kernel::V3D const &q_vector) const;
+  int64_t getHklKey2(Mantid::Kernel::V3D const &hkl) const;
+  int64_t getHklMnpKey2(Mantid::Kernel::V3D const &hkl) const;
 
   /// Add an event to the vector of events for the closest h,k,l
-  void addEvent(std::pair<double, Mantid::Kernel::V3D> event_Q, bool hkl_integ);
+  void addEvent(std::pair<double, Mantid::Kernel::V3D> event_Q, bool hkl_integ,
+                EventListMap &event_lists) const;
   void addModEvent(std::pair<double, Mantid::Kernel::V3D> event_Q,
-                   bool hkl_integ);
+                   bool hkl_integ, EventListMap &event_lists) const;
 
   /// Find the net integrated intensity of a list of Q's using ellipsoids
   boost::shared_ptr<const Mantid::DataObjects::PeakShapeEllipsoid>
@@ -11,6 +11,7 @@
 #include "MantidAPI/CompositeFunction.h"
 #include "MantidAPI/IMDEventWorkspace_fwd.h"
 #include "MantidDataObjects/MDEventWorkspace.h"
+#include "MantidDataObjects/PeakSpatialIndex.h"
 #include "MantidDataObjects/PeaksWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidKernel/System.h"
@@ -69,8 +70,7 @@ private:
   std::vector<Kernel::V3D> E1Vec;
 
   /// Check if peaks overlap
-  void checkOverlap(int i, Mantid::DataObjects::PeaksWorkspace_sptr peakWS,
-                    Mantid::Kernel::SpecialCoordinateSystem CoordinatesToUse,
+  void checkOverlap(int i, const DataObjects::PeakSpatialIndex &peakIndex,
                     double radius);
 };
 
@@ -47,6 +47,7 @@ private:
   getValuesFromOtherDimensions(bool &skipNormalization,
                                uint16_t expInfoIndex = 0) const;
   void cacheDimensionXValues();
+  void cacheDetectorValues(uint16_t expInfoIndex);
   void calculateNormalization(const std::vector<coord_t> &otherValues,
                               Geometry::SymmetryOperation so,
                               uint16_t expInfoIndex, size_t soIndex);
@@ -96,6 +97,22 @@ private:
   Kernel::V3D m_beamDir;
   /// ki-kf for Inelastic convention; kf-ki for Crystallography convention
   std::string convention;
+  /// Values of a detector that do not depend on the symmetry operation
+  struct DetectorValues {
+    /// Index of the detector in the spectrum info
+    size_t index;
+    /// Polar angle of the detector
+    double theta;
+    /// Azimuthal angle of the detector
+    double phi;
+    /// Workspace index of the detector in the flux workspace
+    size_t fluxIndex;
+    /// Solid angle of the detector multiplied by the proton charge
+    double solidAngle;
+  };
+  /// Detectors contributing to the normalization of the current experiment
+  /// info
+  std::vector<DetectorValues> m_detectorValues;
 };
 
 } // namespace MDAlgorithms
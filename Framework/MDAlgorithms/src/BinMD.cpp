@@ -34,6 +34,12 @@ using namespace Mantid::API;
 using namespace Mantid::Geometry;
 using namespace Mantid::DataObjects;
 
+namespace {
+/// Upper limit on the memory used by the per-thread copies of the output
+/// arrays when binning with thread accumulators
+constexpr double MAX_THREAD_ACCUMULATOR_BYTES = 256. * 1024. * 1024.;
+} // namespace
+
 //----------------------------------------------------------------------------------------------
 /** Constructor
  */
@@ -98,10 +104,16 @@ void BinMD::init() {
  *(inclusive)
  * @param chunkMax :: the maximum index in each dimension to consider "valid"
  *(exclusive)
+ * @param boxSignals :: the signal array to add the events to
+ * @param boxErrors :: the squared error array to add the events to
+ * @param boxNumEvents :: the number of events array to add the events to
  */
 template <typename MDE, size_t nd>
 inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
-                            const size_t *const chunkMax) {
+                            const size_t *const chunkMax,
+                            signal_t *const boxSignals,
+                            signal_t *const boxErrors,
+                            signal_t *const boxNumEvents) {
   // An array to hold the rotated/transformed coordinates
   auto outCenter = new coord_t[m_outD];
 
@@ -166,11 +178,11 @@ inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
       //        std::cout << "Box at " << box->getExtentsStr() << " is within a
       //        single bin.\n";
       // Add the CACHED signal from the entire box
-      signals[lastLinearIndex] += box->getSignal();
-      errors[lastLinearIndex] += box->getErrorSquared();
+      boxSignals[lastLinearIndex] += box->getSignal();
+      boxErrors[lastLinearIndex] += box->getErrorSquared();
       // TODO: If DataObjects get a weight, this would need to get the summed
       // weight.
-      numEvents[lastLinearIndex] += static_cast<signal_t>(box->getNPoints());
+      boxNumEvents[lastLinearIndex] += static_cast<signal_t>(box->getNPoints());
 
       // And don't bother looking at each event. This may save lots of time
       // loading from disk.
@@ -213,11 +225,11 @@ inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
 
     if (!badOne) {
       // Sum the signals as doubles to preserve precision
-      signals[linearIndex] += static_cast<signal_t>(it->getSignal());
-      errors[linearIndex] += static_cast<signal_t>(it->getErrorSquared());
+      boxSignals[linearIndex] += static_cast<signal_t>(it->getSignal());
+      boxErrors[linearIndex] += static_cast<signal_t>(it->getErrorSquared());
       // TODO: If DataObjects get a weight, this would need to get the summed
       // weight.
-      numEvents[linearIndex] += 1.0;
+      boxNumEvents[linearIndex] += 1.0;
     }
   }
   // Done with the events list
@@ -226,6 +238,69 @@ inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
   delete[] outCenter;
 }
 
+//----------------------------------------------------------------------------------------------
+/** Bin every leaf box of the workspace in a single parallel pass. Each thread
+ * adds its events to a private copy of the output arrays and the copies are
+ * summed into the output workspace at the end, so the box tree is only
+ * traversed once and the threads never have to synchronise while binning.
+ *
+ * @param ws :: MDEventWorkspace of the given type.
+ * @param numThreads :: the number of threads that may run the binning loop
+ */
+template <typename MDE, size_t nd>
+void BinMD::binWithThreadAccumulators(
+    typename MDEventWorkspace<MDE, nd>::sptr ws, const int numThreads) {
+  // The whole output is a single "chunk"
+  const std::vector<size_t> chunkMin(m_outD, 0);
+  std::vector<size_t> chunkMax(m_outD);
+  for (size_t bd = 0; bd < m_outD; bd++)
+    chunkMax[bd] = m_binDimensions[bd]->getNBins();
+
+  std::unique_ptr<MDImplicitFunction> function(
+      this->getImplicitFunctionForChunk(chunkMin.data(), chunkMax.data()));
+  std::vector<API::IMDNode *> boxes;
+  // Leaf-only; no depth limit; with the implicit function passed to it.
+  ws->getBox()->getBoxes(boxes, 1000, true, function.get());
+  g_log.debug() << "Found " << boxes.size()
+                << " boxes within the implicit function.\n";
+  if (prog)
+    prog->setNumSteps(boxes.size());
+
+  // Each thread allocates (and so first touches) its own accumulator when it
+  // picks up its first box. The three output arrays are stored back to back.
+  const size_t numBins = outWS->getNPoints();
+  std::vector<std::vector<signal_t>> accumulators(numThreads);
+  const int numBoxes = static_cast<int>(boxes.size());
+  PRAGMA_OMP(parallel for schedule(dynamic, 16) num_threads(numThreads))
+  for (int i = 0; i < numBoxes; ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    auto &accumulator = accumulators[PARALLEL_THREAD_NUMBER];
+    if (accumulator.empty())
+      accumulator.resize(3 * numBins, 0.0);
+    auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[i]);
+    if (box && !box->getIsMasked())
+      this->binMDBox(box, chunkMin.data(), chunkMax.data(), accumulator.data(),
+                     accumulator.data() + numBins,
+                     accumulator.data() + 2 * numBins);
+    if (prog)
+      prog->report();
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  // Reduce the per-thread arrays into the output workspace
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int j = 0; j < static_cast<int>(numBins); ++j) {
+    for (const auto &accumulator : accumulators) {
+      if (accumulator.empty())
+        continue;
+      signals[j] += accumulator[j];
+      errors[j] += accumulator[numBins + j];
+      numEvents[j] += accumulator[2 * numBins + j];
+    }
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 /** Perform binning by iterating through every event and placing them in the
  *output workspace
@@ -285,9 +360,22 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     prog->resetNumSteps(100, 0.00, 1.0);
   }
 
-  // Run the chunks in parallel. There is no overlap in the output workspace so
-  // it is thread safe to write to it..
-  // cppcheck-suppress syntaxError
+  // Chunking the output means that boxes spanning several chunks are visited
+  // (and their events transformed) once per chunk. When the output is small
+  // compared with the input it is cheaper to give each thread a private copy
+  // of the output and visit every box exactly once.
+  const int numThreads = PARALLEL_GET_MAX_THREADS;
+  const double numBins = static_cast<double>(outWS->getNPoints());
+  const double accumulatorBytes = 3. * sizeof(signal_t) * numBins * numThreads;
+  if (doParallel && numThreads > 1 &&
+      accumulatorBytes <= MAX_THREAD_ACCUMULATOR_BYTES &&
+      numBins * numThreads <= static_cast<double>(ws->getNPoints())) {
+    this->binWithThreadAccumulators<MDE, nd>(ws, numThreads);
+  } else {
+
+    // Run the chunks in parallel. There is no overlap in the output workspace
+    // so it is thread safe to write to it..
+    // cppcheck-suppress syntaxError
     PRAGMA_OMP( parallel for schedule(dynamic,1) if (doParallel) )
     for (int chunk = 0;
          chunk < int(m_binDimensions[chunkDimension]->getNBins());
@@ -339,7 +427,8 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
         MDBox<MDE, nd> *box = dynamic_cast<MDBox<MDE, nd> *>(boxe);
         // Perform the binning in this separate method.
         if (box && !box->getIsMasked())
-          this->binMDBox(box, chunkMin.data(), chunkMax.data());
+          this->binMDBox(box, chunkMin.data(), chunkMax.data(), signals,
+                         errors, numEvents);
 
         // Progress reporting
         if (prog)
@@ -351,17 +440,18 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
       PARALLEL_END_INTERUPT_REGION
     } // for each chunk in parallel
     PARALLEL_CHECK_INTERUPT_REGION
+  }
 
-    // Now the implicit function
-    if (implicitFunction) {
-      if (prog)
-        prog->report("Applying implicit function.");
-      signal_t nan = std::numeric_limits<signal_t>::quiet_NaN();
-      outWS->applyImplicitFunction(implicitFunction, nan, nan);
-    }
+  // Now the implicit function
+  if (implicitFunction) {
+    if (prog)
+      prog->report("Applying implicit function.");
+    signal_t nan = std::numeric_limits<signal_t>::quiet_NaN();
+    outWS->applyImplicitFunction(implicitFunction, nan, nan);
+  }
 
-    // return the size of the input workspace write buffer to its initial value
-    // bc->setCacheParameters(sizeof(MDE),writeBufSize);
+  // return the size of the input workspace write buffer to its initial value
+  // bc->setCacheParameters(sizeof(MDE),writeBufSize);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -121,12 +121,48 @@ Integrate3DEvents::Integrate3DEvents(
  */
 void Integrate3DEvents::addEvents(
     std::vector<std::pair<double, V3D>> const &event_qs, bool hkl_integ) {
+  addEvents(event_qs, hkl_integ, m_event_lists);
+}
+
+/**
+ * Add the specified event Q's to the given lists of events near peaks rather
+ * than to the lists held by this object. This does not modify the integrator
+ * so it can be called concurrently, provided each thread uses its own
+ * event_lists. The lists must then be added to the integrator with
+ * mergeEvents before integrating.
+ *
+ * @param event_qs    List of event Q vectors to add to lists of Q's associated
+ *                    with peaks.
+ * @param hkl_integ
+ * @param event_lists The lists of events that the event Q's are added to.
+ */
+void Integrate3DEvents::addEvents(
+    std::vector<std::pair<double, V3D>> const &event_qs, bool hkl_integ,
+    EventListMap &event_lists) const {
   if (!maxOrder)
     for (const auto &event_q : event_qs)
-      addEvent(event_q, hkl_integ);
+      addEvent(event_q, hkl_integ, event_lists);
   else
     for (const auto &event_q : event_qs)
-      addModEvent(event_q, hkl_integ);
+      addModEvent(event_q, hkl_integ, event_lists);
+}
+
+/**
+ * Move the lists of events collected by the thread-safe version of addEvents
+ * into the lists held by this object. The input lists are left empty.
+ *
+ * @param event_lists Lists of events near peaks, keyed as m_event_lists.
+ */
+void Integrate3DEvents::mergeEvents(EventListMap &event_lists) {
+  for (auto &item : event_lists) {
+    auto &target = m_event_lists[item.first];
+    if (target.empty()) {
+      target = std::move(item.second);
+    } else {
+      target.insert(target.end(), item.second.cbegin(), item.second.cend());
+    }
+  }
+  event_lists.clear();
 }
 
 std::pair<boost::shared_ptr<const Geometry::PeakShape>,
@@ -783,7 +819,7 @@ int64_t Integrate3DEvents::getHklMnpKey(int h, int k, int l, int m, int n,
  *
  *  @param hkl  The q_vector to be mapped to h,k,l
  */
-int64_t Integrate3DEvents::getHklKey2(V3D const &hkl) {
+int64_t Integrate3DEvents::getHklKey2(V3D const &hkl) const {
   int h = boost::math::iround<double>(hkl[0]);
   int k = boost::math::iround<double>(hkl[1]);
   int l = boost::math::iround<double>(hkl[2]);
@@ -796,7 +832,7 @@ int64_t Integrate3DEvents::getHklKey2(V3D const &hkl) {
  *
  *  @param hkl  The q_vector to be mapped to h,k,l
  */
-int64_t Integrate3DEvents::getHklMnpKey2(V3D const &hkl) {
+int64_t Integrate3DEvents::getHklMnpKey2(V3D const &hkl) const {
   V3D modvec1 = V3D(m_ModHKL[0][0], m_ModHKL[1][0], m_ModHKL[2][0]);
   V3D modvec2 = V3D(m_ModHKL[0][1], m_ModHKL[1][1], m_ModHKL[2][1]);
   V3D modvec3 = V3D(m_ModHKL[0][2], m_ModHKL[1][2], m_ModHKL[2][2]);
@@ -887,7 +923,7 @@ int64_t Integrate3DEvents::getHklMnpKey2(V3D const &hkl) {
  *
  *  @param q_vector  The q_vector to be mapped to h,k,l
  */
-int64_t Integrate3DEvents::getHklKey(V3D const &q_vector) {
+int64_t Integrate3DEvents::getHklKey(V3D const &q_vector) const {
   V3D hkl = m_UBinv * q_vector;
   int h = boost::math::iround<double>(hkl[0]);
   int k = boost::math::iround<double>(hkl[1]);
@@ -903,7 +939,7 @@ int64_t Integrate3DEvents::getHklKey(V3D const &q_vector) {
  *
  *  @param q_vector  The q_vector to be mapped to h,k,l
  */
-int64_t Integrate3DEvents::getHklMnpKey(V3D const &q_vector) {
+int64_t Integrate3DEvents::getHklMnpKey(V3D const &q_vector) const {
   V3D hkl = m_UBinv * q_vector;
 
   V3D modvec1 = V3D(m_ModHKL[0][0], m_ModHKL[1][0], m_ModHKL[2][0]);
@@ -1003,9 +1039,11 @@ int64_t Integrate3DEvents::getHklMnpKey(V3D const &q_vector) {
  * @param event_Q      The Q-vector for the event that may be added to the
  *                     event_lists map, if it is close enough to some peak
  * @param hkl_integ
+ * @param event_lists  The lists of events the event is added to
  */
 void Integrate3DEvents::addEvent(std::pair<double, V3D> event_Q,
-                                 bool hkl_integ) {
+                                 bool hkl_integ,
+                                 EventListMap &event_lists) const {
   int64_t hkl_key;
   if (hkl_integ)
     hkl_key = getHklKey2(event_Q.second);
@@ -1023,7 +1061,7 @@ void Integrate3DEvents::addEvent(std::pair<double, V3D> event_Q,
       else
         event_Q.second = event_Q.second - peak_it->second;
       if (event_Q.second.norm() < m_radius) {
-        m_event_lists[hkl_key].push_back(event_Q);
+        event_lists[hkl_key].push_back(event_Q);
       }
     }
   }
@@ -1042,9 +1080,11 @@ void Integrate3DEvents::addEvent(std::pair<double, V3D> event_Q,
  * @param event_Q      The Q-vector for the event that may be added to the
  *                     event_lists map, if it is close enough to some peak
  * @param hkl_integ
+ * @param event_lists  The lists of events the event is added to
  */
 void Integrate3DEvents::addModEvent(std::pair<double, V3D> event_Q,
-                                    bool hkl_integ) {
+                                    bool hkl_integ,
+                                    EventListMap &event_lists) const {
   int64_t hklmnp_key;
 
   if (hkl_integ)
@@ -1065,9 +1105,9 @@ void Integrate3DEvents::addModEvent(std::pair<double, V3D> event_Q,
 
       if (hklmnp_key % 10000 == 0) {
         if (event_Q.second.norm() < m_radius)
-          m_event_lists[hklmnp_key].push_back(event_Q);
+          event_lists[hklmnp_key].push_back(event_Q);
       } else if (event_Q.second.norm() < s_radius) {
-        m_event_lists[hklmnp_key].push_back(event_Q);
+        event_lists[hklmnp_key].push_back(event_Q);
       }
     }
   }
@@ -65,6 +65,9 @@ void IntegrateEllipsoids::qListFromEventWS(Integrate3DEvents &integrator,
                                            bool hkl_integ) {
   // loop through the eventlists
 
+  // events near the peaks are collected separately by each thread and merged
+  // into the integrator afterwards
+  std::vector<EventListMap> eventLists(PARALLEL_GET_MAX_THREADS);
   int numSpectra = static_cast<int>(wksp->getNumberHistograms());
   PARALLEL_FOR_IF(Kernel::threadSafe(*wksp))
   for (int i = 0; i < numSpectra; ++i) {
@@ -113,12 +116,16 @@ void IntegrateEllipsoids::qListFromEventWS(Integrate3DEvents &integrator,
         qVec = UBinv * qVec;
       qList.emplace_back(raw_event.m_weight, qVec);
     } // end of loop over events in list
-    PARALLEL_CRITICAL(addEvents) { integrator.addEvents(qList, hkl_integ); }
+    integrator.addEvents(qList, hkl_integ, eventLists[PARALLEL_THREAD_NUMBER]);
 
     prog.report();
     PARALLEL_END_INTERUPT_REGION
   } // end of loop over spectra
   PARALLEL_CHECK_INTERUPT_REGION
+
+  for (auto &threadEventLists : eventLists) {
+    integrator.mergeEvents(threadEventLists);
+  }
 }
 
 /**
@@ -138,6 +145,9 @@ void IntegrateEllipsoids::qListFromHistoWS(Integrate3DEvents &integrator,
 
   // loop through the eventlists
 
+  // events near the peaks are collected separately by each thread and merged
+  // into the integrator afterwards
+  std::vector<EventListMap> eventLists(PARALLEL_GET_MAX_THREADS);
   int numSpectra = static_cast<int>(wksp->getNumberHistograms());
   PARALLEL_FOR_IF(Kernel::threadSafe(*wksp))
   for (int i = 0; i < numSpectra; ++i) {
@@ -189,11 +199,15 @@ void IntegrateEllipsoids::qListFromHistoWS(Integrate3DEvents &integrator,
         qList.emplace_back(yVal, qVec);
       }
     }
-    PARALLEL_CRITICAL(addHisto) { integrator.addEvents(qList, hkl_integ); }
+    integrator.addEvents(qList, hkl_integ, eventLists[PARALLEL_THREAD_NUMBER]);
     prog.report();
     PARALLEL_END_INTERUPT_REGION
   } // end of loop over spectra
   PARALLEL_CHECK_INTERUPT_REGION
+
+  for (auto &threadEventLists : eventLists) {
+    integrator.mergeEvents(threadEventLists);
+  }
 }
 
 /** NOTE: This has been adapted from the SaveIsawQvector algorithm.
@@ -481,7 +495,16 @@ void IntegrateEllipsoids::exec() {
   std::vector<double> principalaxis1, principalaxis2, principalaxis3;
   std::vector<double> sateprincipalaxis1, sateprincipalaxis2,
       sateprincipalaxis3;
-  for (size_t i = 0; i < n_peaks; i++) {
+  // The peaks are integrated independently in parallel. The radii of the
+  // peaks passing the I/sigI cut are stored per peak so that the principal
+  // axes statistics are collected in peak order.
+  std::vector<std::vector<double>> acceptedAxesRadii(n_peaks);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int index = 0; index < static_cast<int>(n_peaks); index++) {
+    PARALLEL_START_INTERUPT_REGION
+    const size_t i = static_cast<size_t>(index);
+    double peakInti;
+    double peakSigi;
     const V3D hkl(peaks[i].getIntHKL());
     const V3D mnp(peaks[i].getIntMNP());
 
@@ -528,27 +551,36 @@ void IntegrateEllipsoids::exec() {
           integrator.ellipseIntegrateModEvents(
               E1Vec, peak_q, hkl, mnp, specify_size, adaptiveRadius,
               adaptiveBack_inner_radius, adaptiveBack_outer_radius, axes_radii,
-              inti, sigi);
-      peaks[i].setIntensity(inti);
-      peaks[i].setSigmaIntensity(sigi);
+              peakInti, peakSigi);
+      peaks[i].setIntensity(peakInti);
+      peaks[i].setSigmaIntensity(peakSigi);
       peaks[i].setPeakShape(shape);
       if (axes_radii.size() == 3) {
-        if (inti / sigi > cutoffIsigI || cutoffIsigI == EMPTY_DBL()) {
-          if (mnp == V3D(0, 0, 0)) {
-            principalaxis1.push_back(axes_radii[0]);
-            principalaxis2.push_back(axes_radii[1]);
-            principalaxis3.push_back(axes_radii[2]);
-          } else {
-            sateprincipalaxis1.push_back(axes_radii[0]);
-            sateprincipalaxis2.push_back(axes_radii[1]);
-            sateprincipalaxis3.push_back(axes_radii[2]);
-          }
+        if (peakInti / peakSigi > cutoffIsigI || cutoffIsigI == EMPTY_DBL()) {
+          acceptedAxesRadii[i] = std::move(axes_radii);
         }
       }
     } else {
       peaks[i].setIntensity(0.0);
       peaks[i].setSigmaIntensity(0.0);
     }
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  for (size_t i = 0; i < n_peaks; i++) {
+    const auto &axes_radii = acceptedAxesRadii[i];
+    if (axes_radii.empty())
+      continue;
+    if (peaks[i].getIntMNP() == V3D(0, 0, 0)) {
+      principalaxis1.push_back(axes_radii[0]);
+      principalaxis2.push_back(axes_radii[1]);
+      principalaxis3.push_back(axes_radii[2]);
+    } else {
+      sateprincipalaxis1.push_back(axes_radii[0]);
+      sateprincipalaxis2.push_back(axes_radii[1]);
+      sateprincipalaxis3.push_back(axes_radii[2]);
+    }
   }
   if (principalaxis1.size() > 1) {
     Statistics stats1 = getStatistics(principalaxis1);
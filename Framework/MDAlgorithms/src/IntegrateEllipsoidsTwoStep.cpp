@@ -374,6 +374,9 @@ void IntegrateEllipsoidsTwoStep::qListFromEventWS(Integrate3DEvents &integrator,
 
   m_targWSDescr.m_PreprDetTable = table;
 
+  // events near the peaks are collected separately by each thread and merged
+  // into the integrator afterwards
+  std::vector<EventListMap> eventLists(PARALLEL_GET_MAX_THREADS);
   int numSpectra = static_cast<int>(wksp->getNumberHistograms());
   PARALLEL_FOR_IF(Kernel::threadSafe(*wksp))
   for (int i = 0; i < numSpectra; ++i) {
@@ -422,12 +425,17 @@ void IntegrateEllipsoidsTwoStep::qListFromEventWS(Integrate3DEvents &integrator,
         qVec = UBinv * qVec;
       qList.emplace_back(raw_event.m_weight, qVec);
     } // end of loop over events in list
-    PARALLEL_CRITICAL(addEvents) { integrator.addEvents(qList, hkl_integ); }
+    integrator.addEvents(qList, hkl_integ,
+                         eventLists[PARALLEL_THREAD_NUMBER]);
 
     prog.report();
     PARALLEL_END_INTERUPT_REGION
   } // end of loop over spectra
   PARALLEL_CHECK_INTERUPT_REGION
+
+  for (auto &threadEventLists : eventLists) {
+    integrator.mergeEvents(threadEventLists);
+  }
 }
 
 /**
@@ -472,6 +480,9 @@ void IntegrateEllipsoidsTwoStep::qListFromHistoWS(Integrate3DEvents &integrator,
   else
     m_targWSDescr.m_PreprDetTable = table;
 
+  // events near the peaks are collected separately by each thread and merged
+  // into the integrator afterwards
+  std::vector<EventListMap> eventLists(PARALLEL_GET_MAX_THREADS);
   int numSpectra = static_cast<int>(wksp->getNumberHistograms());
   PARALLEL_FOR_IF(Kernel::threadSafe(*wksp))
   for (int i = 0; i < numSpectra; ++i) {
@@ -517,11 +528,16 @@ void IntegrateEllipsoidsTwoStep::qListFromHistoWS(Integrate3DEvents &integrator,
         qList.emplace_back(yVal, qVec);
       }
     }
-    PARALLEL_CRITICAL(addHisto) { integrator.addEvents(qList, hkl_integ); }
+    integrator.addEvents(qList, hkl_integ,
+                         eventLists[PARALLEL_THREAD_NUMBER]);
     prog.report();
     PARALLEL_END_INTERUPT_REGION
   } // end of loop over spectra
   PARALLEL_CHECK_INTERUPT_REGION
+
+  for (auto &threadEventLists : eventLists) {
+    integrator.mergeEvents(threadEventLists);
+  }
 }
 
 /*
@@ -299,6 +299,12 @@ void IntegratePeaksMD2::integrate(typename MDEventWorkspace<MDE, nd>::sptr ws) {
   // Initialize progress reporting
   int nPeaks = peakWS->getNumberPeaks();
   Progress progress(this, 0., 1., nPeaks);
+  // Index of the peak positions, used to find overlapping peaks without
+  // comparing every pair of peaks.
+  double overlapCellSize = 2.0 * std::max(PeakRadius, BackgroundOuterRadius);
+  if (overlapCellSize <= 0.0)
+    overlapCellSize = 1.0;
+  const PeakSpatialIndex peakIndex(*peakWS, CoordinatesToUse, overlapCellSize);
   for (int i = 0; i < nPeaks; ++i) {
     if (this->getCancel())
       break; // User cancellation
@@ -599,7 +605,7 @@ void IntegratePeaksMD2::integrate(typename MDEventWorkspace<MDE, nd>::sptr ws) {
       }
     }
     checkOverlap(
-        i, peakWS, CoordinatesToUse,
+        i, peakIndex,
         2.0 * std::max(PeakRadiusVector[i], BackgroundOuterRadiusVector[i]));
     // Save it back in the peak object.
     if (signal != 0. || replaceIntensity) {
@@ -750,32 +756,17 @@ void IntegratePeaksMD2::runMaskDetectors(
 }
 
 void IntegratePeaksMD2::checkOverlap(
-    int i, Mantid::DataObjects::PeaksWorkspace_sptr peakWS,
-    Mantid::Kernel::SpecialCoordinateSystem CoordinatesToUse, double radius) {
-  // Get a direct ref to that peak.
-  IPeak &p1 = peakWS->getPeak(i);
-  V3D pos1;
-  if (CoordinatesToUse == Kernel::QLab) //"Q (lab frame)"
-    pos1 = p1.getQLabFrame();
-  else if (CoordinatesToUse == Kernel::QSample) //"Q (sample frame)"
-    pos1 = p1.getQSampleFrame();
-  else if (CoordinatesToUse == Kernel::HKL) //"HKL"
-    pos1 = p1.getHKL();
-  for (int j = i + 1; j < peakWS->getNumberPeaks(); ++j) {
-    // Get a direct ref to rest of peaks peak.
-    IPeak &p2 = peakWS->getPeak(j);
-    V3D pos2;
-    if (CoordinatesToUse == Kernel::QLab) //"Q (lab frame)"
-      pos2 = p2.getQLabFrame();
-    else if (CoordinatesToUse == Kernel::QSample) //"Q (sample frame)"
-      pos2 = p2.getQSampleFrame();
-    else if (CoordinatesToUse == Kernel::HKL) //"HKL"
-      pos2 = p2.getHKL();
-    if (pos1.distance(pos2) < radius) {
-      g_log.warning() << " Warning:  Peak integration spheres for peaks " << i
-                      << " and " << j << " overlap.  Distance between peaks is "
-                      << pos1.distance(pos2) << '\n';
-    }
+    int i, const DataObjects::PeakSpatialIndex &peakIndex, double radius) {
+  const auto index = static_cast<size_t>(i);
+  const V3D &pos1 = peakIndex.position(index);
+  // Only the peaks after this one are reported, as the earlier ones have
+  // already been checked against it.
+  for (const auto j : peakIndex.findWithinRadius(pos1, radius)) {
+    if (j <= index)
+      continue;
+    g_log.warning() << " Warning:  Peak integration spheres for peaks " << i
+                    << " and " << j << " overlap.  Distance between peaks is "
+                    << pos1.distance(peakIndex.position(j)) << '\n';
   }
 }
 //----------------------------------------------------------------------------------------------
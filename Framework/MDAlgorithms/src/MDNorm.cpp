@@ -489,6 +489,8 @@ void MDNorm::exec() {
     cacheDimensionXValues();
 
     if (!skipNormalization) {
+      // The detector geometry is the same for all symmetry operations
+      cacheDetectorValues(expInfoIndex);
       size_t symmOpsIndex = 0;
       for (const auto &so : symmetryOps) {
         calculateNormalization(otherValues, so, expInfoIndex, symmOpsIndex);
@@ -1134,6 +1136,77 @@ void MDNorm::cacheDimensionXValues() {
   }
 }
 
+/**
+ * Stores the angles, flux spectrum and solid angle of every detector of an
+ * experiment info that can contribute to the normalization. These do not
+ * depend on the symmetry operation, so they are computed once and reused for
+ * all of them.
+ * @param expInfoIndex - current experiment info index
+ */
+void MDNorm::cacheDetectorValues(uint16_t expInfoIndex) {
+  const auto &currentExptInfo = *(m_inputWS->getExperimentInfo(expInfoIndex));
+  const double protonCharge = currentExptInfo.run().getProtonCharge();
+  const auto &spectrumInfo = currentExptInfo.spectrumInfo();
+
+  // Mappings
+  const int64_t ndets = static_cast<int64_t>(spectrumInfo.size());
+  bool haveSA = false;
+  API::MatrixWorkspace_const_sptr solidAngleWS =
+      getProperty("SolidAngleWorkspace");
+  API::MatrixWorkspace_const_sptr integrFlux = getProperty("FluxWorkspace");
+  if (solidAngleWS != nullptr) {
+    haveSA = true;
+  }
+  const detid2index_map solidAngDetToIdx =
+      (haveSA) ? solidAngleWS->getDetectorIDToWorkspaceIndexMap()
+               : detid2index_map();
+  const detid2index_map fluxDetToIdx =
+      (m_diffraction) ? integrFlux->getDetectorIDToWorkspaceIndexMap()
+                      : detid2index_map();
+
+  std::vector<DetectorValues> values(ndets);
+  std::vector<char> contributes(ndets, 0);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < ndets; i++) {
+    if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i) ||
+        spectrumInfo.isMasked(i)) {
+      continue;
+    }
+
+    const auto &detector = spectrumInfo.detector(i);
+    // If the dtefctor is a group, this should be the ID of the first detector
+    const auto detID = detector.getID();
+
+    // get the flux spectrum number
+    size_t wsIdx = 0;
+    if (m_diffraction) {
+      auto index = fluxDetToIdx.find(detID);
+      if (index != fluxDetToIdx.end()) {
+        wsIdx = index->second;
+      } else { // masked detector in flux, but not in input workspace
+        continue;
+      }
+    }
+
+    // Get solid angle for this contribution
+    double solid = protonCharge;
+    if (haveSA) {
+      solid = solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0] *
+              protonCharge;
+    }
+    values[i] = {static_cast<size_t>(i),
+                 detector.getTwoTheta(m_samplePos, m_beamDir),
+                 detector.getPhi(), wsIdx, solid};
+    contributes[i] = 1;
+  }
+
+  m_detectorValues.clear();
+  for (int64_t i = 0; i < ndets; i++) {
+    if (contributes[i])
+      m_detectorValues.push_back(values[i]);
+  }
+}
+
 /**
  * Computed the normalization for the input workspace. Results are stored in
  * m_normWS
@@ -1165,36 +1238,19 @@ void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues,
   soMatrix.Invert();
   DblMatrix Qtransform = R * m_UB * soMatrix * m_W;
   Qtransform.Invert();
-  const double protonCharge = currentExptInfo.run().getProtonCharge();
-  const auto &spectrumInfo = currentExptInfo.spectrumInfo();
-
-  // Mappings
-  const int64_t ndets = static_cast<int64_t>(spectrumInfo.size());
-  bool haveSA = false;
-  API::MatrixWorkspace_const_sptr solidAngleWS =
-      getProperty("SolidAngleWorkspace");
-  API::MatrixWorkspace_const_sptr integrFlux = getProperty("FluxWorkspace");
-  if (solidAngleWS != nullptr) {
-    haveSA = true;
-  }
-  const detid2index_map solidAngDetToIdx =
-      (haveSA) ? solidAngleWS->getDetectorIDToWorkspaceIndexMap()
-               : detid2index_map();
-  const detid2index_map fluxDetToIdx =
-      (m_diffraction) ? integrFlux->getDetectorIDToWorkspaceIndexMap()
-                      : detid2index_map();
-
   const size_t vmdDims = (m_diffraction) ? 3 : 4;
   std::vector<std::atomic<signal_t>> signalArray(m_normWS->getNPoints());
   std::vector<std::array<double, 4>> intersections;
   std::vector<double> xValues, yValues;
   std::vector<coord_t> pos, posNew;
 
+  const int64_t ndets = static_cast<int64_t>(m_detectorValues.size());
   double progStep = 0.7 / static_cast<double>(m_numExptInfos * m_numSymmOps);
   double progIndex = static_cast<double>(soIndex + expInfoIndex * m_numSymmOps);
   auto prog =
       std::make_unique<API::Progress>(this, 0.3 + progStep * progIndex,
                                       0.3 + progStep * (1. + progIndex), ndets);
+  API::MatrixWorkspace_const_sptr integrFlux = getProperty("FluxWorkspace");
   bool safe = true;
   if (m_diffraction) {
     safe = Kernel::threadSafe(*integrFlux);
@@ -1204,39 +1260,16 @@ PRAGMA_OMP(parallel for private(intersections, xValues, yValues, pos, posNew) if
 for (int64_t i = 0; i < ndets; i++) {
   PARALLEL_START_INTERUPT_REGION
 
-  if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i) ||
-      spectrumInfo.isMasked(i)) {
-    continue;
-  }
-
-  const auto &detector = spectrumInfo.detector(i);
-  double theta = detector.getTwoTheta(m_samplePos, m_beamDir);
-  double phi = detector.getPhi();
-  // If the dtefctor is a group, this should be the ID of the first detector
-  const auto detID = detector.getID();
-
-  // get the flux spectrum number
-  size_t wsIdx = 0;
-  if (m_diffraction) {
-    auto index = fluxDetToIdx.find(detID);
-    if (index != fluxDetToIdx.end()) {
-      wsIdx = index->second;
-    } else { // masked detector in flux, but not in input workspace
-      continue;
-    }
-  }
+  const auto &detector = m_detectorValues[i];
+  const size_t wsIdx = detector.fluxIndex;
+  const double solid = detector.solidAngle;
 
   // Intersections
-  this->calculateIntersections(intersections, theta, phi, Qtransform,
-                               lowValues[i], highValues[i]);
+  this->calculateIntersections(intersections, detector.theta, detector.phi,
+                               Qtransform, lowValues[detector.index],
+                               highValues[detector.index]);
   if (intersections.empty())
     continue;
-  // Get solid angle for this contribution
-  double solid = protonCharge;
-  if (haveSA) {
-    solid =
-        solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0] * protonCharge;
-  }
   if (m_diffraction) {
     // -- calculate integrals for the intersection --
     // momentum values at intersections
@@ -18,6 +18,8 @@
 #include "MantidGeometry/MDGeometry/MDImplicitFunction.h"
 #include "MantidGeometry/MDGeometry/MDTypes.h"
 #include "MantidGeometry/MDGeometry/QSample.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/System.h"
 #include "MantidKernel/WarningSuppressions.h"
 #include "MantidMDAlgorithms/BinMD.h"
 #include "MantidMDAlgorithms/CreateMDWorkspace.h"
@@ -26,6 +28,7 @@
 #include "MantidMDAlgorithms/SaveMD2.h"
 #include "MantidTestHelpers/MDEventsTestHelper.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include <cxxtest/TestSuite.h>
@@ -298,6 +301,18 @@ public:
                  true /*IterateEvents*/, 20 /*numEventsPerBox*/, VMD(0, 0, 1));
   }
 
+  void test_exec_3D_fewBins_manyEvents() {
+    // Many more events than bins, so the boxes are binned in a single pass
+    // into per-thread output arrays. That needs more than one thread.
+    const int threads = PARALLEL_GET_MAX_THREADS;
+    UNUSED_ARG(threads)
+    PARALLEL_SET_NUM_THREADS(std::max(threads, 4))
+    do_test_exec("", "Axis0,2.0,8.0, 3", "Axis1,2.0,8.0, 3", "Axis2,2.0,8.0, 3",
+                 "", 8 * 20.0 /*signal*/, 3 * 3 * 3 /*# of bins*/,
+                 true /*IterateEvents*/, 20 /*numEventsPerBox*/);
+    PARALLEL_SET_NUM_THREADS(threads)
+  }
+
   bool etta(int x, int base) {
     int ii = x - base / 2;
     if (ii < 0)
@@ -130,6 +130,56 @@ public:
     }
   }
 
+  void test_events_added_to_separate_lists_and_merged() {
+    V3D peak_1(10, 0, 0);
+    V3D peak_2(0, 5, 0);
+    std::vector<std::pair<double, V3D>> peak_q_list{{1., peak_1},
+                                                     {1., peak_2}};
+    DblMatrix UBinv(3, 3, false);
+    UBinv.setRow(0, V3D(.1, 0, 0));
+    UBinv.setRow(1, V3D(0, .2, 0));
+    UBinv.setRow(2, V3D(0, 0, .25));
+
+    std::vector<std::pair<double, V3D>> first_Qs, second_Qs;
+    for (int i = -100; i <= 100; i++) {
+      auto &event_Qs = i % 2 == 0 ? first_Qs : second_Qs;
+      for (const auto &peak : {peak_1, peak_2}) {
+        event_Qs.emplace_back(1., peak + V3D(i / 100.0, 0, 0));
+        event_Qs.emplace_back(1., peak + V3D(0, i / 200.0, 0));
+        event_Qs.emplace_back(1., peak + V3D(0, 0, i / 300.0));
+      }
+    }
+
+    const double radius = 1.3;
+    Integrate3DEvents expected(peak_q_list, UBinv, radius);
+    expected.addEvents(first_Qs, false);
+    expected.addEvents(second_Qs, false);
+
+    Integrate3DEvents merged(peak_q_list, UBinv, radius);
+    EventListMap first_lists, second_lists;
+    merged.addEvents(first_Qs, false, first_lists);
+    merged.addEvents(second_Qs, false, second_lists);
+    TS_ASSERT_EQUALS(first_lists.size(), 2);
+    merged.mergeEvents(first_lists);
+    merged.mergeEvents(second_lists);
+    TS_ASSERT(first_lists.empty());
+    TS_ASSERT(second_lists.empty());
+
+    std::vector<Kernel::V3D> E1Vec;
+    std::vector<double> new_sigma;
+    for (const auto &peak_q : peak_q_list) {
+      double inti_expected, sigi_expected, inti, sigi;
+      expected.ellipseIntegrateEvents(E1Vec, peak_q.second, true, 1.2, 1.2,
+                                      1.3, new_sigma, inti_expected,
+                                      sigi_expected);
+      merged.ellipseIntegrateEvents(E1Vec, peak_q.second, true, 1.2, 1.2, 1.3,
+                                    new_sigma, inti, sigi);
+      TS_ASSERT_DELTA(inti, inti_expected, 1e-9);
+      TS_ASSERT_DELTA(sigi, sigi_expected, 1e-9);
+      TS_ASSERT_DELTA(inti, 603, 0.1);
+    }
+  }
+
   void test_satellites() {
     double inti_all[] = {161, 368.28, 273.28};
     double sigi_all[] = {12.6885, 21.558, 19.2287};
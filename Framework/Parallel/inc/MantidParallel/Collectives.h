@@ -15,50 +15,133 @@
 #include <boost/mpi/collectives.hpp>
 #endif
 
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
 namespace Mantid {
 namespace Parallel {
 
 /** Wrapper for boost::mpi::gather and other collective communication. For
   non-MPI builds an equivalent implementation with reduced functionality is
-  provided.
+  provided. The non-MPI implementations communicate along a binomial tree,
+  i.e., a collective operation takes log2(size) communication steps instead of
+  size steps on the root.
 
   @author Simon Heybrock
   @date 2017
 */
 
 namespace detail {
+/// Rank of this process if the ranks are renumbered such that root is 0
+inline int relativeRank(const Communicator &comm, const int root) {
+  return (comm.rank() - root + comm.size()) % comm.size();
+}
+
+/// Inverse of relativeRank
+inline int absoluteRank(const Communicator &comm, const int relative,
+                        const int root) {
+  return (relative + root) % comm.size();
+}
+
+/** Gather the values of all ranks below this one in a binomial tree rooted at
+ * root. Returns the values ordered by relative rank, starting with the value
+ * of this rank. Ranks other than root pass their values up the tree and
+ * return an empty vector. */
 template <typename T>
-void gather(const Communicator &comm, const T &in_value,
-            std::vector<T> &out_values, int root) {
+std::vector<T> gatherSubtree(const Communicator &comm, const T &in_value,
+                             int root) {
   int tag{0};
-  if (comm.rank() != root) {
-    comm.send(root, tag, in_value);
-  } else {
-    out_values.resize(comm.size());
-    out_values[root] = in_value;
-    for (int rank = 0; rank < comm.size(); ++rank) {
-      if (rank == root)
-        continue;
-      comm.recv(rank, tag, out_values[rank]);
+  const int rank = relativeRank(comm, root);
+  std::vector<T> values{in_value};
+  for (int mask = 1; mask < comm.size(); mask <<= 1) {
+    if (rank & mask) {
+      comm.send(absoluteRank(comm, rank - mask, root), tag, std::move(values));
+      return {};
+    }
+    if (rank + mask < comm.size()) {
+      std::vector<T> subtree;
+      comm.recv(absoluteRank(comm, rank + mask, root), tag, subtree);
+      values.insert(values.end(), std::make_move_iterator(subtree.begin()),
+                    std::make_move_iterator(subtree.end()));
     }
   }
+  return values;
+}
+
+template <typename T>
+void gather(const Communicator &comm, const T &in_value,
+            std::vector<T> &out_values, int root) {
+  auto values = gatherSubtree(comm, in_value, root);
+  if (comm.rank() != root)
+    return;
+  out_values.resize(comm.size());
+  for (int rank = 0; rank < comm.size(); ++rank)
+    out_values[absoluteRank(comm, rank, root)] = std::move(values[rank]);
 }
 
 template <typename T>
 void gather(const Communicator &comm, const T &in_value, int root) {
-  int tag{0};
-  if (comm.rank() != root) {
-    comm.send(root, tag, in_value);
-  } else {
+  if (comm.rank() == root)
     throw std::logic_error(
         "Parallel::gather on root rank without output argument.");
+  gatherSubtree(comm, in_value, root);
+}
+
+template <typename T>
+void broadcast(const Communicator &comm, T &value, int root) {
+  int tag{0};
+  const int rank = relativeRank(comm, root);
+  // The parent of a rank in the tree is the rank with the lowest bit cleared.
+  int mask = 1;
+  for (; mask < comm.size(); mask <<= 1) {
+    if (rank & mask) {
+      comm.recv(absoluteRank(comm, rank - mask, root), tag, value);
+      break;
+    }
+  }
+  for (mask >>= 1; mask > 0; mask >>= 1) {
+    if (rank + mask < comm.size())
+      comm.send(absoluteRank(comm, rank + mask, root), tag, value);
   }
 }
 
-template <typename... T>
-void all_gather(const Communicator &comm, T &&... args) {
-  for (int root = 0; root < comm.size(); ++root)
-    gather(comm, std::forward<T>(args)..., root);
+template <typename T>
+void all_gather(const Communicator &comm, const T &in_value,
+                std::vector<T> &out_values) {
+  gather(comm, in_value, out_values, 0);
+  broadcast(comm, out_values, 0);
+}
+
+/** Combine the values of all ranks below this one in a binomial tree rooted
+ * at root with op, in order of relative rank. Root receives the result in
+ * out_value, all other ranks pass their partial results up the tree. */
+template <typename T, typename Op>
+void reduce(const Communicator &comm, const T &in_value, T &out_value, Op op,
+            int root) {
+  int tag{0};
+  const int rank = relativeRank(comm, root);
+  T value(in_value);
+  for (int mask = 1; mask < comm.size(); mask <<= 1) {
+    if (rank & mask) {
+      comm.send(absoluteRank(comm, rank - mask, root), tag, value);
+      return;
+    }
+    if (rank + mask < comm.size()) {
+      T subtree;
+      comm.recv(absoluteRank(comm, rank + mask, root), tag, subtree);
+      value = op(value, subtree);
+    }
+  }
+  out_value = std::move(value);
+}
+
+template <typename T, typename Op>
+void all_reduce(const Communicator &comm, const T &in_value, T &out_value,
+                Op op) {
+  reduce(comm, in_value, out_value, op, 0);
+  broadcast(comm, out_value, 0);
 }
 
 template <typename T>
@@ -83,6 +166,15 @@ template <typename... T> void gather(const Communicator &comm, T &&... args) {
   detail::gather(comm, std::forward<T>(args)...);
 }
 
+template <typename... T>
+void broadcast(const Communicator &comm, T &&... args) {
+#ifdef MPI_EXPERIMENTAL
+  if (!comm.hasBackend())
+    return boost::mpi::broadcast(comm, std::forward<T>(args)...);
+#endif
+  detail::broadcast(comm, std::forward<T>(args)...);
+}
+
 template <typename... T>
 void all_gather(const Communicator &comm, T &&... args) {
 #ifdef MPI_EXPERIMENTAL
@@ -92,6 +184,15 @@ void all_gather(const Communicator &comm, T &&... args) {
   detail::all_gather(comm, std::forward<T>(args)...);
 }
 
+template <typename... T>
+void all_reduce(const Communicator &comm, T &&... args) {
+#ifdef MPI_EXPERIMENTAL
+  if (!comm.hasBackend())
+    return boost::mpi::all_reduce(comm, std::forward<T>(args)...);
+#endif
+  detail::all_reduce(comm, std::forward<T>(args)...);
+}
+
 template <typename... T>
 void all_to_all(const Communicator &comm, T &&... args) {
 #ifdef MPI_EXPERIMENTAL
@@ -13,21 +13,45 @@
 
 #include <boost/archive/binary_iarchive.hpp>
 #include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/vector.hpp>
 
-#include <chrono>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <istream>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <ostream>
 #include <sstream>
+#include <stdexcept>
 #include <tuple>
+#include <type_traits>
+#include <typeindex>
 #include <vector>
 
 namespace Mantid {
 namespace Parallel {
 namespace detail {
 
+/** A message in flight between two ranks of a ThreadingBackend.
+
+  Data of trivially copyable type, i.e., single values, vectors and arrays of
+  such values, is held as a std::vector of the element type. A vector that is
+  sent as an rvalue is moved into the message and moved out again by the
+  receiver, so it is handed over without any copy. All other types are
+  serialised into an archive.
+*/
+struct ThreadingMessage {
+  /// Type of the elements if the message holds unserialised data
+  std::type_index type{typeid(void)};
+  /// Unserialised data, a std::vector with elements of the above type
+  std::shared_ptr<void> elements;
+  /// Serialised data of types that are not trivially copyable
+  std::unique_ptr<std::stringbuf> archive;
+};
+
 /** ThreadingBackend provides a backend for data exchange between Communicators
   in the case of non-MPI builds when communication between threads is used to
   mimic MPI calls. This is FOR UNIT TESTING ONLY and is NOT FOR PRODUCTION CODE.
@@ -60,95 +84,134 @@ public:
 
 private:
   int m_size{1};
-  std::map<std::tuple<int, int, int>,
-           std::vector<std::unique_ptr<std::stringbuf>>>
-      m_buffer;
+  std::map<std::tuple<int, int, int>, std::deque<ThreadingMessage>> m_buffer;
   std::mutex m_mutex;
+  std::condition_variable m_messageAdded;
 };
 
 namespace detail {
 template <class T>
-void saveToStream(boost::archive::binary_oarchive &oa, const T &data) {
-  oa.operator<<(data);
+using IsTriviallyCopyable = typename std::is_trivially_copyable<T>::type;
+
+template <class T> ThreadingMessage serialise(const T &data) {
+  // Must wrap std::stringbuf in a unique_ptr since gcc on RHEL7 does not
+  // support moving a stringbuf (incomplete C++11 support?).
+  ThreadingMessage message;
+  message.archive = std::make_unique<std::stringbuf>();
+  std::ostream os(message.archive.get());
+  {
+    // The binary_oarchive must be scoped to prevent a segmentation fault. I
+    // believe the reason is that otherwise recv() may end up reading from the
+    // buffer while the oarchive is still alive. I do not really understand
+    // this though, since it is *not* writing to the buffer, somehow the
+    // oarchive destructor must be doing something that requires the buffer.
+    boost::archive::binary_oarchive oa(os);
+    oa.operator<<(data);
+  }
+  return message;
+}
+template <class T> ThreadingMessage wrap(std::vector<T> &&data) {
+  ThreadingMessage message;
+  message.type = typeid(T);
+  message.elements = std::make_shared<std::vector<T>>(std::move(data));
+  return message;
+}
+
+template <class T>
+ThreadingMessage makeMessage(const T &data, std::true_type) {
+  return wrap(std::vector<T>(1, data));
 }
 template <class T>
-void saveToStream(boost::archive::binary_oarchive &oa,
-                  const std::vector<T> &data) {
-  oa.operator<<(data);
+ThreadingMessage makeMessage(const std::vector<T> &data, std::true_type) {
+  return wrap(std::vector<T>(data));
 }
 template <class T>
-void saveToStream(boost::archive::binary_oarchive &oa, const T *data,
-                  const size_t count) {
-  oa.operator<<(count);
-  for (size_t i = 0; i < count; ++i)
-    oa.operator<<(data[i]);
+ThreadingMessage makeMessage(std::vector<T> &&data, std::true_type) {
+  return wrap(std::move(data));
 }
 template <class T>
-size_t loadFromStream(boost::archive::binary_iarchive &ia, T &data) {
+ThreadingMessage makeMessage(const T &data, std::false_type) {
+  return serialise(data);
+}
+
+template <class T> ThreadingMessage toMessage(const T &data) {
+  return makeMessage(data, IsTriviallyCopyable<T>{});
+}
+template <class T> ThreadingMessage toMessage(const std::vector<T> &data) {
+  return makeMessage(data, IsTriviallyCopyable<T>{});
+}
+template <class T> ThreadingMessage toMessage(std::vector<T> &&data) {
+  return makeMessage(std::move(data), IsTriviallyCopyable<T>{});
+}
+template <class T>
+ThreadingMessage toMessage(const T *data, const size_t count) {
+  return wrap(std::vector<T>(data, data + count));
+}
+
+/// Returns the vector of elements held by a message that was not serialised
+template <class T> std::vector<T> &elements(ThreadingMessage &message) {
+  if (!message.elements || message.type != typeid(T))
+    throw std::logic_error("ThreadingBackend: Type of received data does not "
+                           "match type of sent data.");
+  return *static_cast<std::vector<T> *>(message.elements.get());
+}
+
+template <class T>
+void readMessage(ThreadingMessage &message, T &data, std::true_type) {
+  data = elements<T>(message).at(0);
+}
+template <class T>
+void readMessage(ThreadingMessage &message, std::vector<T> &data,
+                 std::true_type) {
+  // The message is owned by the receiver, take the data without a copy.
+  data = std::move(elements<T>(message));
+}
+template <class T>
+void readMessage(ThreadingMessage &message, T &data, std::false_type) {
+  std::istream is(message.archive.get());
+  boost::archive::binary_iarchive ia(is);
   ia.operator>>(data);
+}
+
+template <class T> size_t fromMessage(ThreadingMessage &message, T &data) {
+  readMessage(message, data, IsTriviallyCopyable<T>{});
   return sizeof(T);
 }
 template <class T>
-size_t loadFromStream(boost::archive::binary_iarchive &ia,
-                      std::vector<T> &data) {
-  ia.operator>>(data);
+size_t fromMessage(ThreadingMessage &message, std::vector<T> &data) {
+  readMessage(message, data, IsTriviallyCopyable<T>{});
   return data.size() * sizeof(T);
 }
 template <class T>
-size_t loadFromStream(boost::archive::binary_iarchive &ia, T *data,
-                      const size_t count) {
-  size_t received;
-  ia.operator>>(received);
-  for (size_t i = 0; i < count; ++i) {
-    if (i >= received)
-      return i * sizeof(T);
-    ia.operator>>(data[i]);
-  }
-  return count * sizeof(T);
+size_t fromMessage(ThreadingMessage &message, T *data, const size_t count) {
+  const auto &values = elements<T>(message);
+  const size_t received = std::min(count, values.size());
+  std::copy(values.begin(), values.begin() + received, data);
+  return received * sizeof(T);
 }
 } // namespace detail
 
 template <typename... T>
 void ThreadingBackend::send(int source, int dest, int tag, T &&... args) {
-  // Must wrap std::stringbuf in a unique_ptr since gcc on RHEL7 does not
-  // support moving a stringbuf (incomplete C++11 support?).
-  auto buf = std::make_unique<std::stringbuf>();
-  std::ostream os(buf.get());
+  auto message = detail::toMessage(std::forward<T>(args)...);
   {
-    // The binary_oarchive must be scoped to prevent a segmentation fault. I
-    // believe the reason is that otherwise recv() may end up reading from the
-    // buffer while the oarchive is still alive. I do not really understand this
-    // though, since it is *not* writing to the buffer, somehow the oarchive
-    // destructor must be doing something that requires the buffer.
-    boost::archive::binary_oarchive oa(os);
-    detail::saveToStream(oa, std::forward<T>(args)...);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_buffer[std::make_tuple(source, dest, tag)].push_back(std::move(message));
   }
-  std::lock_guard<std::mutex> lock(m_mutex);
-  m_buffer[std::make_tuple(source, dest, tag)].push_back(std::move(buf));
+  m_messageAdded.notify_all();
 }
 
 template <typename... T>
 Status ThreadingBackend::recv(int dest, int source, int tag, T &&... args) {
-  const auto key = std::make_tuple(source, dest, tag);
-  std::unique_ptr<std::stringbuf> buf;
-  while (true) {
-    // Sleep to reduce lock contention. Without this execution times can grow
-    // enormously on Windows.
-    std::this_thread::sleep_for(std::chrono::microseconds(10));
-    std::lock_guard<std::mutex> lock(m_mutex);
-    auto it = m_buffer.find(key);
-    if (it == m_buffer.end())
-      continue;
-    auto &queue = it->second;
-    if (queue.empty())
-      continue;
-    buf = std::move(queue.front());
-    queue.erase(queue.begin());
-    break;
+  ThreadingMessage message;
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto &queue = m_buffer[std::make_tuple(source, dest, tag)];
+    m_messageAdded.wait(lock, [&queue] { return !queue.empty(); });
+    message = std::move(queue.front());
+    queue.pop_front();
   }
-  std::istream is(buf.get());
-  boost::archive::binary_iarchive ia(is);
-  return Status(detail::loadFromStream(ia, std::forward<T>(args)...));
+  return Status(detail::fromMessage(message, std::forward<T>(args)...));
 }
 
 template <typename... T>
@@ -12,6 +12,9 @@
 #include "MantidParallel/Collectives.h"
 #include "MantidTestHelpers/ParallelRunner.h"
 
+#include <algorithm>
+#include <string>
+
 using namespace Mantid;
 using namespace Parallel;
 
@@ -46,6 +49,32 @@ void run_gather_short_version(const Communicator &comm) {
   }
 }
 
+void run_gather_vectors(const Communicator &comm) {
+  for (int root = 0; root < comm.size(); ++root) {
+    std::vector<int> value(comm.rank(), comm.rank());
+    std::vector<std::vector<int>> result;
+    TS_ASSERT_THROWS_NOTHING(Parallel::gather(comm, value, result, root));
+    if (comm.rank() == root) {
+      TS_ASSERT_EQUALS(result.size(), comm.size());
+      for (int i = 0; i < comm.size(); ++i) {
+        TS_ASSERT_EQUALS(result[i], std::vector<int>(i, i));
+      }
+    } else {
+      TS_ASSERT(result.empty());
+    }
+  }
+}
+
+void run_broadcast(const Communicator &comm) {
+  for (int root = 0; root < comm.size(); ++root) {
+    std::string value;
+    if (comm.rank() == root)
+      value = "data from rank " + std::to_string(root);
+    TS_ASSERT_THROWS_NOTHING(Parallel::broadcast(comm, value, root));
+    TS_ASSERT_EQUALS(value, "data from rank " + std::to_string(root));
+  }
+}
+
 void run_all_gather(const Communicator &comm) {
   int value = 123 * comm.rank();
   std::vector<int> result;
@@ -56,6 +85,25 @@ void run_all_gather(const Communicator &comm) {
   }
 }
 
+void run_all_reduce(const Communicator &comm) {
+  int value = 123 * comm.rank();
+  int result = -1;
+  TS_ASSERT_THROWS_NOTHING(Parallel::all_reduce(
+      comm, value, result, [](int a, int b) { return a + b; }));
+  TS_ASSERT_EQUALS(result, 123 * comm.size() * (comm.size() - 1) / 2);
+}
+
+void run_all_reduce_vectors(const Communicator &comm) {
+  std::vector<int> value{comm.rank(), -comm.rank()};
+  std::vector<int> result;
+  TS_ASSERT_THROWS_NOTHING(Parallel::all_reduce(
+      comm, value, result,
+      [](const std::vector<int> &a, const std::vector<int> &b) {
+        return std::vector<int>{std::max(a[0], b[0]), std::max(a[1], b[1])};
+      }));
+  TS_ASSERT_EQUALS(result, (std::vector<int>{comm.size() - 1, 0}));
+}
+
 void run_all_to_all(const Communicator &comm) {
   std::vector<int> data;
   for (int rank = 0; rank < comm.size(); ++rank)
@@ -82,8 +130,20 @@ public:
     ParallelTestHelpers::runParallel(run_gather_short_version);
   }
 
+  void test_gather_vectors() {
+    ParallelTestHelpers::runParallel(run_gather_vectors);
+  }
+
+  void test_broadcast() { ParallelTestHelpers::runParallel(run_broadcast); }
+
   void test_all_gather() { ParallelTestHelpers::runParallel(run_all_gather); }
 
+  void test_all_reduce() { ParallelTestHelpers::runParallel(run_all_reduce); }
+
+  void test_all_reduce_vectors() {
+    ParallelTestHelpers::runParallel(run_all_reduce_vectors);
+  }
+
   void test_all_to_all() { ParallelTestHelpers::runParallel(run_all_to_all); }
 };
 
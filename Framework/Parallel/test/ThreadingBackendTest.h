@@ -11,6 +11,8 @@
 
 #include "MantidParallel/ThreadingBackend.h"
 
+#include <string>
+
 using Mantid::Parallel::detail::ThreadingBackend;
 
 class ThreadingBackendTest : public CxxTest::TestSuite {
@@ -31,6 +33,63 @@ public:
     ThreadingBackend backend{2};
     TS_ASSERT_EQUALS(backend.size(), 2);
   }
+
+  void test_send_recv_value() {
+    ThreadingBackend backend{2};
+    backend.send(0, 1, 0, 42.0);
+    double value{0.0};
+    TS_ASSERT_EQUALS(backend.recv(1, 0, 0, value).count<double>(), 1);
+    TS_ASSERT_EQUALS(value, 42.0);
+  }
+
+  void test_send_recv_preserves_order() {
+    ThreadingBackend backend{2};
+    backend.send(0, 1, 0, 1);
+    backend.send(0, 1, 0, 2);
+    int first{0};
+    int second{0};
+    backend.recv(1, 0, 0, first);
+    backend.recv(1, 0, 0, second);
+    TS_ASSERT_EQUALS(first, 1);
+    TS_ASSERT_EQUALS(second, 2);
+  }
+
+  void test_send_recv_moved_vector_does_not_copy() {
+    ThreadingBackend backend{2};
+    std::vector<int> data(100, 7);
+    const auto *address = data.data();
+    backend.send(0, 1, 0, std::move(data));
+    std::vector<int> result;
+    backend.recv(1, 0, 0, result);
+    TS_ASSERT_EQUALS(result, std::vector<int>(100, 7));
+    TS_ASSERT_EQUALS(result.data(), address);
+  }
+
+  void test_send_recv_vector_into_array() {
+    ThreadingBackend backend{2};
+    const std::vector<int> data{1, 2, 3};
+    backend.send(0, 1, 0, data);
+    std::vector<int> result(5, 0);
+    TS_ASSERT_EQUALS(
+        backend.recv(1, 0, 0, result.data(), result.size()).count<int>(), 3);
+    TS_ASSERT_EQUALS(result, (std::vector<int>{1, 2, 3, 0, 0}));
+  }
+
+  void test_send_recv_serialised_type() {
+    ThreadingBackend backend{2};
+    const std::vector<std::string> data{"a", "bc"};
+    backend.send(0, 1, 0, data);
+    std::vector<std::string> result;
+    backend.recv(1, 0, 0, result);
+    TS_ASSERT_EQUALS(result, data);
+  }
+
+  void test_recv_with_different_type_throws() {
+    ThreadingBackend backend{2};
+    backend.send(0, 1, 0, 1);
+    double value;
+    TS_ASSERT_THROWS(backend.recv(1, 0, 0, value), const std::logic_error &);
+  }
 };
 
 #endif /* MANTID_PARALLEL_THREADINGBACKENDTEST_H_ */
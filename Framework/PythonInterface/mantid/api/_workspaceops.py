@@ -18,7 +18,8 @@ import sys
 
 from six import Iterator, get_function_code, iteritems
 
-from mantid.api import AnalysisDataServiceImpl, ITableWorkspace, Workspace, WorkspaceGroup, performBinaryOp
+from mantid.api import (AnalysisDataServiceImpl, ITableWorkspace, Workspace, WorkspaceExpression, WorkspaceGroup,
+                        performBinaryOp)
 from mantid.kernel.funcinspect import customise_func, lhs_info
 
 
@@ -34,6 +35,9 @@ def attach_binary_operators_to_workspace():
     def add_operator_func(attr, algorithm, inplace, reverse):
         # Wrapper for the function call
         def op_wrapper(self, other):
+            # Let WorkspaceExpression handle workspace-expression arithmetic
+            if isinstance(other, WorkspaceExpression):
+                return NotImplemented
             # Get the result variable to know what to call the output
             result_info = lhs_info()
             # Pass off to helper
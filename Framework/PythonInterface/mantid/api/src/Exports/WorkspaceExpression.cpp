@@ -0,0 +1,52 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/WorkspaceExpression.h"
+#include "MantidAPI/MatrixWorkspace.h"
+
+#include <boost/python/class.hpp>
+#include <boost/python/operators.hpp>
+#include <boost/python/self.hpp>
+
+using Mantid::API::MatrixWorkspace_sptr;
+using Mantid::API::WorkspaceExpression;
+using namespace boost::python;
+
+void export_WorkspaceExpression() {
+  class_<WorkspaceExpression>(
+      "WorkspaceExpression",
+      "Arithmetic on workspaces that is only evaluated on request. Combining "
+      "expressions, workspaces and numbers with + - * / builds up the "
+      "expression and evaluate() computes it in one pass, creating a single "
+      "output workspace.",
+      init<MatrixWorkspace_sptr>((arg("self"), arg("workspace")),
+                                 "Construct an expression from a workspace"))
+      .def(init<double>((arg("self"), arg("value")),
+                        "Construct an expression from a number"))
+      .def("evaluate", &WorkspaceExpression::evaluate, arg("self"),
+           "Computes the expression and returns the result in a new "
+           "workspace that is not added to the analysis data service")
+      .def(self + self)
+      .def(self - self)
+      .def(self * self)
+      .def(self / self)
+      .def(self + other<double>())
+      .def(self - other<double>())
+      .def(self * other<double>())
+      .def(self / other<double>())
+      .def(other<double>() + self)
+      .def(other<double>() - self)
+      .def(other<double>() * self)
+      .def(other<double>() / self)
+      .def(self + other<MatrixWorkspace_sptr>())
+      .def(self - other<MatrixWorkspace_sptr>())
+      .def(self * other<MatrixWorkspace_sptr>())
+      .def(self / other<MatrixWorkspace_sptr>())
+      .def(other<MatrixWorkspace_sptr>() + self)
+      .def(other<MatrixWorkspace_sptr>() - self)
+      .def(other<MatrixWorkspace_sptr>() * self)
+      .def(other<MatrixWorkspace_sptr>() / self);
+}
@@ -7,9 +7,18 @@
 #include "MantidDataObjects/EventList.h"
 #include "MantidPythonInterface/kernel/GetPointer.h"
 #include <boost/python/class.hpp>
+#include <boost/python/errors.hpp>
 #include <boost/python/register_ptr_to_python.hpp>
 #include <boost/python/return_arg.hpp>
 
+#include <algorithm>
+
+// See
+// http://docs.scipy.org/doc/numpy/reference/c-api.array.html#PY_ARRAY_UNIQUE_SYMBOL
+#define PY_ARRAY_UNIQUE_SYMBOL DATAOBJECTS_ARRAY_API
+#define NO_IMPORT_ARRAY
+#include <numpy/arrayobject.h>
+
 using namespace boost::python;
 using namespace Mantid::DataObjects;
 
@@ -20,6 +29,44 @@ void addEventToEventList(EventList &self, double tof,
                          Mantid::Types::Core::DateAndTime pulsetime) {
   self.addEventQuickly(Mantid::Types::Event::TofEvent(tof, pulsetime));
 }
+
+/**
+ * Copy the time-of-flight of every event into a read-only numpy array. The
+ * events are read directly, without the intermediate vector that getTofs
+ * fills, but they are copied: a view would dangle as soon as the event
+ * vector is reallocated by a modification of the list.
+ * @param events :: The events of the list
+ * @return A 1D numpy array holding the times-of-flight
+ */
+template <typename EventType>
+PyObject *copyTofs(const std::vector<EventType> &events) {
+  npy_intp dims[1] = {static_cast<npy_intp>(events.size())};
+  PyObject *nparray = PyArray_SimpleNew(1, dims, NPY_DOUBLE);
+  if (!nparray)
+    throw_error_already_set();
+  auto *arr = reinterpret_cast<PyArrayObject *>(nparray);
+  std::transform(events.cbegin(), events.cend(),
+                 static_cast<double *>(PyArray_DATA(arr)),
+                 [](const EventType &event) { return event.tof(); });
+#if NPY_API_VERSION >= 0x00000007 //(1.7)
+  PyArray_CLEARFLAGS(arr, NPY_ARRAY_WRITEABLE);
+#else
+  arr->flags &= ~NPY_WRITEABLE;
+#endif
+  return nparray;
+}
+
+PyObject *getTofsView(const EventList &self) {
+  switch (self.getEventType()) {
+  case Mantid::API::TOF:
+    return copyTofs(self.getEvents());
+  case Mantid::API::WEIGHTED:
+    return copyTofs(self.getWeightedEvents());
+  case Mantid::API::WEIGHTED_NOTIME:
+    return copyTofs(self.getWeightedEventsNoTime());
+  }
+  throw std::runtime_error("EventList: invalid event type.");
+}
 } // namespace
 
 void export_EventList() {
@@ -30,6 +77,10 @@ void export_EventList() {
       .def("addEventQuickly", &addEventToEventList,
            args("self", "tof", "pulsetime"),
            "Create TofEvent and add to EventList.")
+      .def("getTofsView", &getTofsView, args("self"),
+           "Get a read-only array of the TOFs of the events. The TOFs are "
+           "copied once, straight from the events, so the array stays valid "
+           "when the event list is modified.")
       .def("__iadd__",
            (EventList & (EventList::*)(const EventList &)) &
                EventList::operator+=,
@@ -0,0 +1,48 @@
+# Mantid Repository : https://github.com/mantidproject/mantid
+#
+# Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+#     NScD Oak Ridge National Laboratory, European Spallation Source
+#     & Institut Laue - Langevin
+# SPDX - License - Identifier: GPL - 3.0 +
+from __future__ import (absolute_import, division, print_function)
+
+from mantid.api import mtd, WorkspaceExpression
+from mantid.simpleapi import CreateSampleWorkspace
+import numpy as np
+import unittest
+
+
+class WorkspaceExpressionTest(unittest.TestCase):
+    def tearDown(self):
+        mtd.clear()
+
+    def test_expression_matches_binary_operations(self):
+        sample = CreateSampleWorkspace(StoreInADS=False)
+        can = CreateSampleWorkspace(StoreInADS=False)
+        vanadium = CreateSampleWorkspace(StoreInADS=False)
+        eager = (sample - can * 0.9) / vanadium * 2.
+        lazy = ((WorkspaceExpression(sample) - 0.9 * WorkspaceExpression(can)) / vanadium * 2.).evaluate()
+        for i in range(sample.getNumberHistograms()):
+            np.testing.assert_allclose(lazy.readY(i), eager.readY(i))
+            np.testing.assert_allclose(lazy.readE(i), eager.readE(i))
+
+    def test_workspace_on_the_left_of_an_expression(self):
+        sample = CreateSampleWorkspace(StoreInADS=False)
+        vanadium = CreateSampleWorkspace(StoreInADS=False)
+        expression = sample - WorkspaceExpression(vanadium) * 0.5
+        self.assertTrue(isinstance(expression, WorkspaceExpression))
+        lazy = expression.evaluate()
+        eager = sample - vanadium * 0.5
+        for i in range(sample.getNumberHistograms()):
+            np.testing.assert_allclose(lazy.readY(i), eager.readY(i))
+            np.testing.assert_allclose(lazy.readE(i), eager.readE(i))
+
+    def test_result_is_not_added_to_ads(self):
+        sample = CreateSampleWorkspace(StoreInADS=False)
+        result = (WorkspaceExpression(sample) + 1.).evaluate()
+        self.assertFalse(mtd.doesExist('result'))
+        np.testing.assert_allclose(result.readY(0), sample.readY(0) + 1.)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -71,5 +71,29 @@ class EventListTest(unittest.TestCase):
         self.assertEqual(evl.getNumberEvents(), 10)
         self.assertEqual(evl.getTofMax(), float(9.0))
 
+    def test_tofs_view(self):
+        evl = self.createRandomEventList(20)
+
+        tof = evl.getTofsView()
+
+        self.assertEqual(len(tof), 20)
+        self.assertEqual(list(tof), list(evl.getTofs()))
+        self.assertFalse(tof.flags.writeable)
+
+    def test_tofs_view_is_valid_after_the_list_is_modified(self):
+        evl = self.createRandomEventList(20)
+
+        tof = evl.getTofsView()
+        for i in range(1000):
+            evl.addEventQuickly(float(100 + i), DateAndTime(i))
+
+        self.assertEqual(list(tof), [float(i) for i in range(20)])
+
+    def test_tofs_view_of_empty_list_is_read_only(self):
+        tof = EventList().getTofsView()
+
+        self.assertEqual(len(tof), 0)
+        self.assertFalse(tof.flags.writeable)
+
 if __name__ == '__main__':
     unittest.main()